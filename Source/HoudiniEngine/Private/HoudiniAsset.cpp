@@ -46,6 +46,10 @@ bool UHoudiniAsset::HapiLoad(TArray<FString>& OutAvailableAssetNames)
 	}
 
 
+	// If hda has been changed or never loaded, then all instantiated nodes should rebuild, otherwise we are just loading it into another session
+	const bool bReload = !FHoudiniEngine::Get().IsAssetLoadedInAnySession(this) ||
+		(FPaths::FileExists(FilePath.FilePath) && (IFileManager::Get().GetTimeStamp(*FilePath.FilePath) != LastEditTime));
+
 	HAPI_AssetLibraryId LibraryId = -1;
 
 	// First, load .hda file.
@@ -103,7 +107,11 @@ bool UHoudiniAsset::HapiLoad(TArray<FString>& OutAvailableAssetNames)
 		}
 
 		OutAvailableAssetNames = AvailableAssetNames;
-		InstantiatedNodes.Empty();
+		if (bReload)
+		{
+			InstantiatedNodes.Empty();
+			FHoudiniEngine::Get().UnregisterLoadedAsset(this);  // Other sessions should also load the new one
+		}
 
 		FHoudiniEngine::Get().RegisterLoadedAsset(this);
 
@@ -113,6 +121,14 @@ bool UHoudiniAsset::HapiLoad(TArray<FString>& OutAvailableAssetNames)
 	return false;
 }
 
+uint32 UHoudiniAsset::GetContentHash() const
+{
+	if (FPaths::FileExists(FilePath.FilePath))
+		return HashCombine(GetTypeHash(FilePath.FilePath), GetTypeHash(IFileManager::Get().GetTimeStamp(*FilePath.FilePath)));
+
+	return FCrc::MemCrc32(LibraryBuffer.GetData(), LibraryBuffer.Num());
+}
+
 bool UHoudiniAsset::NeedLoad()
 {
 	if (!FHoudiniEngine::Get().IsAssetLoaded(this))
@@ -180,30 +180,75 @@ void UHoudiniCurvesComponent::ExpandSelection()
 
 void UHoudiniCurvesComponent::FrustumSelect(const FConvexVolume& Frustum)
 {
+	RefreshDirtyCurveBounds();
+
 	const FTransform& ComponentTransform = GetComponentTransform();
+	auto IntersectBoundsLambda = [&](const FBox& Bounds, bool& bOutFullyContained)
+		{
+			const FBox WorldBounds = Bounds.TransformBy(ComponentTransform);
+			return Frustum.IntersectBox(WorldBounds.GetCenter(), WorldBounds.GetExtent(), bOutFullyContained);
+		};
+
 	if (SelectedClass == EHoudiniAttributeOwner::Point)
 	{
-		TArray<int32> SelectedPointIndices;
-		for (int32 PointIdx = 0; PointIdx < Points.Num(); ++PointIdx)
+		TBitArray<> bPointsSelected(false, Points.Num());
+		for (const FHoudiniCurve& Curve : Curves)
 		{
-			if (Frustum.IntersectPoint(ComponentTransform.TransformPosition(Points[PointIdx].Transform.GetLocation())))
-				SelectedPointIndices.Add(PointIdx);
+			bool bFullyContained = false;
+			if (!Curve.Bounds.IsValid || !IntersectBoundsLambda(Curve.Bounds, bFullyContained))
+				continue;
+
+			for (int32 ChunkIdx = 0; ChunkIdx < Curve.PointChunkBounds.Num(); ++ChunkIdx)
+			{
+				bool bChunkFullyContained = bFullyContained;
+				if (!bChunkFullyContained && !IntersectBoundsLambda(Curve.PointChunkBounds[ChunkIdx], bChunkFullyContained))
+					continue;
+
+				const int32 EndIdx = FMath::Min((ChunkIdx + 1) * HOUDINI_CURVE_BOUNDS_CHUNK_SIZE, Curve.PointIndices.Num());
+				for (int32 VtxIdx = ChunkIdx * HOUDINI_CURVE_BOUNDS_CHUNK_SIZE; VtxIdx < EndIdx; ++VtxIdx)
+				{
+					const int32& PointIdx = Curve.PointIndices[VtxIdx];
+					if (!bPointsSelected[PointIdx] && (bChunkFullyContained ||
+						Frustum.IntersectPoint(ComponentTransform.TransformPosition(Points[PointIdx].Transform.GetLocation()))))
+						bPointsSelected[PointIdx] = true;
+				}
+			}
 		}
-		SelectedIndices = SelectedPointIndices;
+
+		SelectedIndices.Empty();
+		for (TConstSetBitIterator<> BitIter(bPointsSelected); BitIter; ++BitIter)
+			SelectedIndices.Add(BitIter.GetIndex());
 	}
 	else if (SelectedClass == EHoudiniAttributeOwner::Prim)
 	{
 		TArray<int32> SelectedCurveIndices;
 		for (int32 CurveIdx = 0; CurveIdx < Curves.Num(); ++CurveIdx)
 		{
-			for (const FVector& DisplayPoint : Curves[CurveIdx].DisplayPoints)
+			const FHoudiniCurve& Curve = Curves[CurveIdx];
+			bool bFullyContained = false;
+			if (Curve.DisplayChunkBounds.IsEmpty() || !IntersectBoundsLambda(Curve.Bounds, bFullyContained))
+				continue;
+
+			bool bSelected = bFullyContained;
+			const TArray<FVector>& DisplayPoints = Curve.DisplayPoints;
+			for (int32 ChunkIdx = 0; !bSelected && (ChunkIdx < Curve.DisplayChunkBounds.Num()); ++ChunkIdx)
 			{
-				if (Frustum.IntersectPoint(ComponentTransform.TransformPosition(DisplayPoint)))
+				if (!IntersectBoundsLambda(Curve.DisplayChunkBounds[ChunkIdx], bSelected) || bSelected)
+					continue;
+
+				const int32 EndIdx = FMath::Min((ChunkIdx + 1) * HOUDINI_CURVE_BOUNDS_CHUNK_SIZE, DisplayPoints.Num() - 1);
+				for (int32 DisplayIdx = ChunkIdx * HOUDINI_CURVE_BOUNDS_CHUNK_SIZE; DisplayIdx <= EndIdx; ++DisplayIdx)
 				{
-					SelectedCurveIndices.Add(CurveIdx);
-					break;
+					if (Frustum.IntersectPoint(ComponentTransform.TransformPosition(DisplayPoints[DisplayIdx])))
+					{
+						bSelected = true;
+						break;
+					}
 				}
 			}
+
+			if (bSelected)
+				SelectedCurveIndices.Add(CurveIdx);
 		}
 		SelectedIndices = SelectedCurveIndices;
 	}
@@ -211,27 +256,56 @@ void UHoudiniCurvesComponent::FrustumSelect(const FConvexVolume& Frustum)
 
 void UHoudiniCurvesComponent::SphereSelect(const FVector& Centroid, const float& Radius, const bool& bAppend)
 {
+	RefreshDirtyCurveBounds();
+
 	const FTransform ComponentTransform = GetComponentTransform();
+	const double RadiusSquared = double(Radius) * double(Radius);
+	auto IntersectBoundsLambda = [&](const FBox& Bounds)
+		{
+			return Bounds.IsValid && (Bounds.TransformBy(ComponentTransform).ComputeSquaredDistanceToPoint(Centroid) < RadiusSquared);
+		};
+
+	// Visit points in sphere, by curves and point chunks that intersect with sphere, return true to stop visiting this curve
+	auto ForEachPointInSphereLambda = [&](const FHoudiniCurve& Curve, TFunctionRef<bool(const int32&)> OnVisit)
+		{
+			if (!IntersectBoundsLambda(Curve.Bounds))
+				return;
+
+			for (int32 ChunkIdx = 0; ChunkIdx < Curve.PointChunkBounds.Num(); ++ChunkIdx)
+			{
+				if (!IntersectBoundsLambda(Curve.PointChunkBounds[ChunkIdx]))
+					continue;
+
+				const int32 EndIdx = FMath::Min((ChunkIdx + 1) * HOUDINI_CURVE_BOUNDS_CHUNK_SIZE, Curve.PointIndices.Num());
+				for (int32 VtxIdx = ChunkIdx * HOUDINI_CURVE_BOUNDS_CHUNK_SIZE; VtxIdx < EndIdx; ++VtxIdx)
+				{
+					const int32& PointIdx = Curve.PointIndices[VtxIdx];
+					if ((FVector::Distance(ComponentTransform.TransformPosition(Points[PointIdx].Transform.GetLocation()), Centroid) < Radius) && OnVisit(PointIdx))
+						return;
+				}
+			}
+		};
+
 	if (SelectedClass == EHoudiniAttributeOwner::Point)
 	{
+		TBitArray<> bPointsInSphere(false, Points.Num());
+		for (const FHoudiniCurve& Curve : Curves)
+			ForEachPointInSphereLambda(Curve, [&](const int32& PointIdx) { bPointsInSphere[PointIdx] = true; return false; });
+
 		if (bAppend)
 		{
 			const TSet<int32> SelectedIdxSet = TSet<int32>(SelectedIndices);
-			for (int32 PointIdx = 0; PointIdx < Points.Num(); ++PointIdx)
+			for (TConstSetBitIterator<> BitIter(bPointsInSphere); BitIter; ++BitIter)
 			{
-				if (!SelectedIdxSet.Contains(PointIdx) &&
-					FVector::Distance(ComponentTransform.TransformPosition(Points[PointIdx].Transform.GetLocation()), Centroid) < Radius)
-					SelectedIndices.Add(PointIdx);
+				if (!SelectedIdxSet.Contains(BitIter.GetIndex()))
+					SelectedIndices.Add(BitIter.GetIndex());
 			}
 		}
 		else
 		{
 			SelectedIndices.Empty();
-			for (int32 PointIdx = 0; PointIdx < Points.Num(); ++PointIdx)
-			{
-				if (FVector::Distance(ComponentTransform.TransformPosition(Points[PointIdx].Transform.GetLocation()), Centroid) < Radius)
-					SelectedIndices.Add(PointIdx);
-			}
+			for (TConstSetBitIterator<> BitIter(bPointsInSphere); BitIter; ++BitIter)
+				SelectedIndices.Add(BitIter.GetIndex());
 		}
 
 		if (!SelectedIndices.IsEmpty())
@@ -239,38 +313,16 @@ void UHoudiniCurvesComponent::SphereSelect(const FVector& Centroid, const float&
 	}
 	else if (SelectedClass == EHoudiniAttributeOwner::Prim)
 	{
-		if (bAppend)
-		{
-			TSet<int32> SelectedIdxSet = TSet<int32>(SelectedIndices);
-			for (int32 PrimIdx = 0; PrimIdx < Curves.Num(); ++PrimIdx)
-			{
-				if (SelectedIdxSet.Contains(PrimIdx))
-					continue;
+		const TSet<int32> SelectedIdxSet = bAppend ? TSet<int32>(SelectedIndices) : TSet<int32>();
+		if (!bAppend)
+			SelectedIndices.Empty();
 
-				for (const int32& PointIdx : Curves[PrimIdx].PointIndices)
-				{
-					if (FVector::Distance(ComponentTransform.TransformPosition(Points[PointIdx].Transform.GetLocation()), Centroid) < Radius)
-					{
-						SelectedIndices.Add(PrimIdx);
-						break;
-					}
-				}
-			}
-		}
-		else
+		for (int32 PrimIdx = 0; PrimIdx < Curves.Num(); ++PrimIdx)
 		{
-			SelectedIndices.Empty();
-			for (int32 PrimIdx = 0; PrimIdx < Curves.Num(); ++PrimIdx)
-			{
-				for (const int32& PointIdx : Curves[PrimIdx].PointIndices)
-				{
-					if (FVector::Distance(ComponentTransform.TransformPosition(Points[PointIdx].Transform.GetLocation()), Centroid) < Radius)
-					{
-						SelectedIndices.Add(PrimIdx);
-						break;
-					}
-				}
-			}
+			if (SelectedIdxSet.Contains(PrimIdx))
+				continue;
+
+			ForEachPointInSphereLambda(Curves[PrimIdx], [&](const int32& PointIdx) { SelectedIndices.Add(PrimIdx); return true; });
 		}
 
 		if (!SelectedIndices.IsEmpty())
@@ -469,7 +521,7 @@ void UHoudiniCurvesComponent::InsertPoint(const FConvexVolume& Frustum, const FR
 			ParmAttrib->DuplicateAppend(TArray<int32>{ TemplatePointIdx });
 		}
 
-		Curve.DisplayPoints.Empty();  // Will refresh later
+		Curve.ResetDisplay();  // Will refresh later
 		SelectedClass = EHoudiniAttributeOwner::Point;
 		SelectedIndices = TArray<int32>{ NewPointIdx };
 
@@ -533,7 +585,7 @@ bool UHoudiniCurvesComponent::SplitSelection()
 			if (SplitVtxIndices.IsEmpty())
 				continue;
 			
-			Curve.DisplayPoints.Empty();
+			Curve.ResetDisplay();
 			SplitCurveIndices.Add(CurveIdx);
 			SplitCurveVtxIndices.Add(SplitVtxIndices);
 		}
@@ -734,7 +786,7 @@ bool UHoudiniCurvesComponent::JoinSelection()
 
 				bPrevfused = (FoundIdx >= 0);
 				if (bPrevfused || LastSelectedPointIdx == PointIdx)
-					Curve.DisplayPoints.Empty();
+					Curve.ResetDisplay();
 			}
 		}
 		
@@ -829,7 +881,7 @@ bool UHoudiniCurvesComponent::JoinSelection()
 		{
 			JoinCurveIndices.Remove(CurveIndices.Key);
 			FHoudiniCurve& Curve = Curves[CurveIndices.Key];
-			Curve.DisplayPoints.Empty();
+			Curve.ResetDisplay();
 			TArray<int32>& PointIndices = Curve.PointIndices;
 			for (const int32& JoinCurveIdx : CurveIndices.Value)
 			{
@@ -1277,6 +1329,9 @@ void UHoudiniCurvesComponent::DuplicateSelection()
 
 			NewCurve.Color = SrcCurve.Color;
 			NewCurve.DisplayPoints = SrcCurve.DisplayPoints;
+			NewCurve.PointChunkBounds = SrcCurve.PointChunkBounds;
+			NewCurve.DisplayChunkBounds = SrcCurve.DisplayChunkBounds;
+			NewCurve.Bounds = SrcCurve.Bounds;
 
 			Curves.Add(NewCurve);
 			NewSelectedCurveIndices.Add(Curves.Num() - 1);
@@ -1334,7 +1389,7 @@ void UHoudiniCurvesComponent::RemoveSelection()
 				else
 				{
 					ChangedCurveIndices.Add(CurveIdx - CurveIndicesToRemove.Num());  // Some curves may pending removed before, so minus the num curves to remove 
-					Curves[CurveIdx].DisplayPoints.Empty();  // Do NOT RefreshDisplayPoints here, as points have NOT been removed yet
+					Curves[CurveIdx].ResetDisplay();  // Do NOT RefreshDisplayPoints here, as points have NOT been removed yet
 				}
 			}
 		}
@@ -1455,7 +1510,7 @@ void UHoudiniCurvesComponent::ProjectSelection()
 		for (const int32& SelectedIdx : SelectedIndices)
 		{
 			UniquePointIndices.Append(Curves[SelectedIdx].PointIndices);
-			Curves[SelectedIdx].DisplayPoints.Empty();  // Force to refresh display points
+			Curves[SelectedIdx].ResetDisplay();  // Force to refresh display points
 		}
 		SelectedPointIndices = UniquePointIndices.Array();
 	}
@@ -1533,17 +1588,17 @@ void UHoudiniCurvesComponent::ProjectSelection()
 	ReDeltaInfo = DeltaInfoPrefix + CurrPositionsStr;
 	UnDeltaInfo = DeltaInfoPrefix + CurrPositionsStr;
 
-	// Finally, trigger curves to refresh display points
+	// Finally, trigger curves to refresh display points and bounds, Points curves have no display points, but their point bounds are also stale
 	for (FHoudiniCurve& Curve : Curves)
 	{
-		if (Curve.NoNeedDisplay() || Curve.DisplayPoints.IsEmpty())
+		if (Curve.PointChunkBounds.IsEmpty())  // Already reset
 			continue;
 
 		for (const int32& PointIdx : Curve.PointIndices)
 		{
 			if (FHoudiniEngineUtils::BinarySearch(SelectedPointIndices, PointIdx) >= 0)
 			{
-				Curve.DisplayPoints.Empty();
+				Curve.ResetDisplay();
 				break;
 			}
 		}
@@ -1657,50 +1712,88 @@ void UHoudiniCurvesComponent::ScaleSelection(const FVector& DeltaScale, const FV
 
 int32 UHoudiniCurvesComponent::RayCast(const FRay& ClickRay, FVector& OutRayCastPos) const
 {
+	RefreshDirtyCurveBounds();
+
 	const FTransform& ComponentTransform = GetComponentTransform();
 	const FVector TargetPos = ClickRay.PointAt(99999999.0);
+	auto GetDistLowerBoundLambda = [&](const FBox& Bounds)  // Lower bound of distances between the ray and any elements inside bounds
+		{
+			FVector Center, Extent;
+			Bounds.TransformBy(ComponentTransform).GetCenterAndExtents(Center, Extent);
+			return FMath::Max(FMath::PointDistToSegment(Center, ClickRay.Origin, TargetPos) - Extent.Size(), 0.0);
+		};
+
+	// Visit curves from near to far, so that most of the curves and chunks could be skipped
+	TArray<TPair<double, int32>> CurveDistIndices;
+	for (int32 CurveIdx = 0; CurveIdx < Curves.Num(); ++CurveIdx)
+	{
+		if (Curves[CurveIdx].Bounds.IsValid)
+			CurveDistIndices.Emplace(GetDistLowerBoundLambda(Curves[CurveIdx].Bounds), CurveIdx);
+	}
+	CurveDistIndices.Sort([](const TPair<double, int32>& A, const TPair<double, int32>& B) { return A.Key < B.Key; });
 
 	int32 ElemIdx = -1;
 	double MinDist = -1.0;
 	if (SelectedClass == EHoudiniAttributeOwner::Point)
 	{
-		for (int32 PointIdx = 0; PointIdx < Points.Num(); ++PointIdx)
+		for (const TPair<double, int32>& CurveDistIdx : CurveDistIndices)
 		{
-			const FVector WorldPos = ComponentTransform.TransformPosition(Points[PointIdx].Transform.GetLocation());
-			const double Distance = FMath::PointDistToSegment(WorldPos, ClickRay.Origin, TargetPos);
-			if ((MinDist > Distance) || (ElemIdx < 0))
+			if ((ElemIdx >= 0) && (CurveDistIdx.Key >= MinDist))
+				break;
+
+			const FHoudiniCurve& Curve = Curves[CurveDistIdx.Value];
+			for (int32 ChunkIdx = 0; ChunkIdx < Curve.PointChunkBounds.Num(); ++ChunkIdx)
 			{
-				MinDist = Distance;
-				OutRayCastPos = WorldPos;
-				ElemIdx = PointIdx;
+				if ((ElemIdx >= 0) && (GetDistLowerBoundLambda(Curve.PointChunkBounds[ChunkIdx]) >= MinDist))
+					continue;
+
+				const int32 EndIdx = FMath::Min((ChunkIdx + 1) * HOUDINI_CURVE_BOUNDS_CHUNK_SIZE, Curve.PointIndices.Num());
+				for (int32 VtxIdx = ChunkIdx * HOUDINI_CURVE_BOUNDS_CHUNK_SIZE; VtxIdx < EndIdx; ++VtxIdx)
+				{
+					const int32& PointIdx = Curve.PointIndices[VtxIdx];
+					const FVector WorldPos = ComponentTransform.TransformPosition(Points[PointIdx].Transform.GetLocation());
+					const double Distance = FMath::PointDistToSegment(WorldPos, ClickRay.Origin, TargetPos);
+					if ((MinDist > Distance) || (ElemIdx < 0))
+					{
+						MinDist = Distance;
+						OutRayCastPos = WorldPos;
+						ElemIdx = PointIdx;
+					}
+				}
 			}
 		}
 	}
 	else if (SelectedClass == EHoudiniAttributeOwner::Prim)
 	{
-		TArray<FVector> WorldPositions;
-		WorldPositions.Reserve(Points.Num());
-		for (const FHoudiniCurvePoint& Point : Points)
-			WorldPositions.Add(ComponentTransform.TransformPosition(Point.Transform.GetLocation()));
-
-		for (int32 CurveIdx = 0; CurveIdx < Curves.Num(); ++CurveIdx)
+		for (const TPair<double, int32>& CurveDistIdx : CurveDistIndices)
 		{
-			const TArray<FVector>& DisplayPoints = Curves[CurveIdx].DisplayPoints;
-			FVector PrevDisplayPos = ComponentTransform.TransformPosition(DisplayPoints[0]);
-			for (int32 DisplayIdx = 1; DisplayIdx < DisplayPoints.Num(); ++DisplayIdx)
+			if ((ElemIdx >= 0) && (CurveDistIdx.Key >= MinDist))
+				break;
+
+			const FHoudiniCurve& Curve = Curves[CurveDistIdx.Value];
+			const TArray<FVector>& DisplayPoints = Curve.DisplayPoints;
+			for (int32 ChunkIdx = 0; ChunkIdx < Curve.DisplayChunkBounds.Num(); ++ChunkIdx)
 			{
-				const FVector CurrDisplayPos = ComponentTransform.TransformPosition(DisplayPoints[DisplayIdx]);
-				FVector CurveMinPos, ViewMinPos;
-				FMath::SegmentDistToSegment(PrevDisplayPos, CurrDisplayPos,
-					ClickRay.Origin, TargetPos, CurveMinPos, ViewMinPos);
-				PrevDisplayPos = CurrDisplayPos;
-
-				const double Dist = (CurveMinPos - ViewMinPos).Length();
-				if (Dist < MinDist || MinDist < 0.0)
+				if ((ElemIdx >= 0) && (GetDistLowerBoundLambda(Curve.DisplayChunkBounds[ChunkIdx]) >= MinDist))
+					continue;
+
+				const int32 EndIdx = FMath::Min((ChunkIdx + 1) * HOUDINI_CURVE_BOUNDS_CHUNK_SIZE, DisplayPoints.Num() - 1);
+				FVector PrevDisplayPos = ComponentTransform.TransformPosition(DisplayPoints[ChunkIdx * HOUDINI_CURVE_BOUNDS_CHUNK_SIZE]);
+				for (int32 DisplayIdx = ChunkIdx * HOUDINI_CURVE_BOUNDS_CHUNK_SIZE + 1; DisplayIdx <= EndIdx; ++DisplayIdx)
 				{
-					MinDist = Dist;
-					OutRayCastPos = CurveMinPos;
-					ElemIdx = CurveIdx;
+					const FVector CurrDisplayPos = ComponentTransform.TransformPosition(DisplayPoints[DisplayIdx]);
+					FVector CurveMinPos, ViewMinPos;
+					FMath::SegmentDistToSegment(PrevDisplayPos, CurrDisplayPos,
+						ClickRay.Origin, TargetPos, CurveMinPos, ViewMinPos);
+					PrevDisplayPos = CurrDisplayPos;
+
+					const double Dist = (CurveMinPos - ViewMinPos).Length();
+					if (Dist < MinDist || MinDist < 0.0)
+					{
+						MinDist = Dist;
+						OutRayCastPos = CurveMinPos;
+						ElemIdx = CurveDistIdx.Value;
+					}
 				}
 			}
 		}
@@ -1710,6 +1803,53 @@ int32 UHoudiniCurvesComponent::RayCast(const FRay& ClickRay, FVector& OutRayCast
 }
 
 void UHoudiniCurvesComponent::RefreshCurveDisplayPoints(const int32& CurveIdx)
+{
+	BuildCurveDisplayPoints(CurveIdx);
+	RefreshCurveBounds(CurveIdx);
+}
+
+void UHoudiniCurvesComponent::RefreshCurveBounds(const int32& CurveIdx)
+{
+	FHoudiniCurve& Curve = Curves[CurveIdx];
+	Curve.Bounds.Init();
+
+	const TArray<int32>& PointIndices = Curve.PointIndices;
+	Curve.PointChunkBounds.SetNum(FMath::DivideAndRoundUp(PointIndices.Num(), HOUDINI_CURVE_BOUNDS_CHUNK_SIZE));
+	for (int32 ChunkIdx = 0; ChunkIdx < Curve.PointChunkBounds.Num(); ++ChunkIdx)
+	{
+		FBox& ChunkBounds = Curve.PointChunkBounds[ChunkIdx];
+		ChunkBounds.Init();
+		const int32 EndIdx = FMath::Min((ChunkIdx + 1) * HOUDINI_CURVE_BOUNDS_CHUNK_SIZE, PointIndices.Num());
+		for (int32 VtxIdx = ChunkIdx * HOUDINI_CURVE_BOUNDS_CHUNK_SIZE; VtxIdx < EndIdx; ++VtxIdx)
+			ChunkBounds += Points[PointIndices[VtxIdx]].Transform.GetLocation();
+		Curve.Bounds += ChunkBounds;
+	}
+
+	const TArray<FVector>& DisplayPoints = Curve.DisplayPoints;
+	Curve.DisplayChunkBounds.SetNum(FMath::DivideAndRoundUp(FMath::Max(DisplayPoints.Num() - 1, 0), HOUDINI_CURVE_BOUNDS_CHUNK_SIZE));
+	for (int32 ChunkIdx = 0; ChunkIdx < Curve.DisplayChunkBounds.Num(); ++ChunkIdx)
+	{
+		FBox& ChunkBounds = Curve.DisplayChunkBounds[ChunkIdx];
+		ChunkBounds.Init();
+		const int32 EndIdx = FMath::Min((ChunkIdx + 1) * HOUDINI_CURVE_BOUNDS_CHUNK_SIZE, DisplayPoints.Num() - 1);
+		for (int32 DisplayIdx = ChunkIdx * HOUDINI_CURVE_BOUNDS_CHUNK_SIZE; DisplayIdx <= EndIdx; ++DisplayIdx)  // Also include the end of the last segment
+			ChunkBounds += DisplayPoints[DisplayIdx];
+		Curve.Bounds += ChunkBounds;
+	}
+}
+
+void UHoudiniCurvesComponent::RefreshDirtyCurveBounds() const
+{
+	UHoudiniCurvesComponent* MutableThis = const_cast<UHoudiniCurvesComponent*>(this);
+	for (int32 CurveIdx = 0; CurveIdx < Curves.Num(); ++CurveIdx)
+	{
+		const FHoudiniCurve& Curve = Curves[CurveIdx];
+		if (Curve.NeedRefreshBounds() || (Curve.DisplayPoints.IsEmpty() && !Curve.NoNeedDisplay()))
+			MutableThis->RefreshCurveDisplayPoints(CurveIdx);
+	}
+}
+
+void UHoudiniCurvesComponent::BuildCurveDisplayPoints(const int32& CurveIdx)
 {
 	FHoudiniCurve& Curve = Curves[CurveIdx];
 	TArray<FVector>& DisplayPoints = Curve.DisplayPoints;
@@ -2081,11 +2221,16 @@ bool UHoudiniCurvesComponent::HapiUpload(const TArray<UHoudiniCurvesComponent*>&
 		NumVertices, NumPoints, NumPrims, ChangedClass, PointAttribs, PrimAttribs);
 
 
-	FHoudiniSharedMemoryGeometryInput SHMGeoInput(NumPoints, NumPrims, NumVertices);
-	SHMGeoInput.AppendAttribute(HAPI_ATTRIB_ROT, EHoudiniAttributeOwner::Point, EHoudiniInputAttributeStorage::Float, 4, NumPoints * 4);
-	SHMGeoInput.AppendAttribute(HAPI_ATTRIB_SCALE, EHoudiniAttributeOwner::Point, EHoudiniInputAttributeStorage::Float, 3, NumPoints * 3);
-	SHMGeoInput.AppendAttribute(HAPI_CURVE_CLOSED, EHoudiniAttributeOwner::Prim, EHoudiniInputAttributeStorage::Int, 1, NumPrims);
-	SHMGeoInput.AppendAttribute(HAPI_CURVE_TYPE, EHoudiniAttributeOwner::Prim, EHoudiniInputAttributeStorage::Int, 1, NumPrims);
+	// Geometry and curve attributes will be fully written, or kept from the previous upload, so need NOT zero them
+	FHoudiniSharedMemoryGeometryInput SHMGeoInput(NumPoints, NumPrims, NumVertices, false);
+	SHMGeoInput.AppendAttribute(HAPI_ATTRIB_ROT, EHoudiniAttributeOwner::Point, EHoudiniInputAttributeStorage::Float, 4, NumPoints * 4,
+		EHoudiniInputAttributeCompression::None, false);
+	SHMGeoInput.AppendAttribute(HAPI_ATTRIB_SCALE, EHoudiniAttributeOwner::Point, EHoudiniInputAttributeStorage::Float, 3, NumPoints * 3,
+		EHoudiniInputAttributeCompression::None, false);
+	SHMGeoInput.AppendAttribute(HAPI_CURVE_CLOSED, EHoudiniAttributeOwner::Prim, EHoudiniInputAttributeStorage::Int, 1, NumPrims,
+		EHoudiniInputAttributeCompression::None, false);
+	SHMGeoInput.AppendAttribute(HAPI_CURVE_TYPE, EHoudiniAttributeOwner::Prim, EHoudiniInputAttributeStorage::Int, 1, NumPrims,
+		EHoudiniInputAttributeCompression::None, false);
 	
 	SHMGeoInput.AppendGroup(TCHAR_TO_UTF8(*EditGroupName), EHoudiniAttributeOwner::Prim, 1, true);
 	const bool bPointSelected = ChangedClass == EHoudiniAttributeOwner::Point;
@@ -2102,6 +2247,9 @@ bool UHoudiniCurvesComponent::HapiUpload(const TArray<UHoudiniCurvesComponent*>&
 
 	float* const SHM = SHMGeoInput.GetSharedMemory(FString::Printf(TEXT("curve_%08x"), SHMInputNodeId), InOutHandle);
 
+	// If the segment still holds the previous upload of the same layout, we only need to rewrite the changed curves
+	const bool bLayoutUnchanged = FHoudiniSharedMemoryArena::UpdateLayoutKey(InOutHandle, HashCombine(SHMGeoInput.GetLayoutHash(),
+		UHoudiniEditableGeometry::GetUploadLayoutKey(TConstArrayView<const UHoudiniEditableGeometry*>((const UHoudiniEditableGeometry**)HCCs.GetData(), HCCs.Num()))));
 
 	float* PositionDataPtr = SHM;
 	int32* VertexDataPtr = (int32*)(PositionDataPtr + NumPoints * 3);
@@ -2124,6 +2272,19 @@ bool UHoudiniCurvesComponent::HapiUpload(const TArray<UHoudiniCurvesComponent*>&
 	NumPrims = 0;  // Here represent the previous count, and the start index
 	for (const UHoudiniCurvesComponent* HCC : HCCs)
 	{
+		if (bLayoutUnchanged && !HCC->NeedUpload())
+		{
+			PositionDataPtr += HCC->Points.Num() * 3;
+			RotDataPtr += HCC->Points.Num() * 4;
+			ScaleDataPtr += HCC->Points.Num() * 3;
+			CurveClosedDataPtr += HCC->Curves.Num();
+			CurveTypeDataPtr += HCC->Curves.Num();
+			VertexDataPtr += HCC->NumVertices() + HCC->Curves.Num();
+			NumPoints += HCC->Points.Num();
+			NumPrims += HCC->Curves.Num();
+			continue;
+		}
+
 		for (const FHoudiniCurvePoint& Point : HCC->Points)
 		{
 			const FVector3f Position = FVector3f(Point.Transform.GetLocation() * POSITION_SCALE_TO_HOUDINI_F);
@@ -2189,7 +2350,7 @@ bool UHoudiniCurvesComponent::HapiUpload(const TArray<UHoudiniCurvesComponent*>&
 
 	// We should empty delta info, to mark this EditGeo unchanged
 	for (UHoudiniCurvesComponent* HCC : HCCs)
-		HCC->ResetDeltaInfo();
+		HCC->MarkUploaded();
 
 	return SHMGeoInput.HapiUpload(SHMInputNodeId, SHM);
 }
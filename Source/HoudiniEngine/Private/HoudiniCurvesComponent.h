@@ -8,6 +8,7 @@
 
 
 #define HOUDINI_RANDOM_ID FMath::Abs((int32)FPlatformTime::Cycles())
+#define HOUDINI_CURVE_BOUNDS_CHUNK_SIZE 32  // Num points or display segments per chunk bounds
 
 USTRUCT()
 struct HOUDINIENGINE_API FHoudiniCurvePoint
@@ -62,8 +63,20 @@ struct HOUDINIENGINE_API FHoudiniCurve
 
 	TArray<int32> DisplayIndices;  // Align display points to vertices, Num() == PointIndices.Num(), only curvey curves have this
 
+	// Two-level bounds (curve -> chunks) in local space, to accelerate picking, selection and visualizer culling.
+	// Refreshed with DisplayPoints, so a single curve changed will only rebuild its own bounds
+	TArray<FBox> PointChunkBounds;  // Bounds of every HOUDINI_CURVE_BOUNDS_CHUNK_SIZE points of PointIndices
+
+	TArray<FBox> DisplayChunkBounds;  // Bounds of every HOUDINI_CURVE_BOUNDS_CHUNK_SIZE segments of DisplayPoints
+
+	FBox Bounds = FBox(ForceInit);  // Union of all chunk bounds
+
 	FORCEINLINE bool NoNeedDisplay() const { return ((Type == EHoudiniCurveType::Points) || (PointIndices.Num() <= 1)); }
 
+	FORCEINLINE void ResetDisplay() { DisplayPoints.Empty(); PointChunkBounds.Empty(); DisplayChunkBounds.Empty(); Bounds.Init(); }  // Will refresh later
+
+	FORCEINLINE bool NeedRefreshBounds() const { return PointChunkBounds.Num() != FMath::DivideAndRoundUp(PointIndices.Num(), HOUDINI_CURVE_BOUNDS_CHUNK_SIZE); }
+
 	static FVector Bezier(const FVector& P0, const FVector& P1, const FVector& P2, const FVector& P3, const double& u);
 
 	static FVector CatmullRom(const FVector& P0, const FVector& P1, const FVector& P2, const FVector& P3, const double& u);
@@ -95,6 +108,10 @@ protected:
 	void GetPointsBounds(const TArray<int32>& PointIndices,  // PointIndices.Num() must >= 1
 		FVector& OutMin, FVector& OutMax) const; 
 
+	void BuildCurveDisplayPoints(const int32& CurveIdx);
+
+	void RefreshCurveBounds(const int32& CurveIdx);
+
 public:
 	virtual int32 NumVertices() const override;
 
@@ -119,7 +136,9 @@ public:
 
 	FORCEINLINE const TArray<FHoudiniCurvePoint>& GetPoints() const { return Points; }
 
-	void RefreshCurveDisplayPoints(const int32& CurveIdx);
+	void RefreshCurveDisplayPoints(const int32& CurveIdx);  // Will also refresh bounds of this curve
+
+	void RefreshDirtyCurveBounds() const;  // Only refresh curves whose bounds are out of date, should call before using bounds
 
 
 	// -------- Draw --------
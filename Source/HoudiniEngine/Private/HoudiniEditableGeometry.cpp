@@ -432,6 +432,20 @@ void UHoudiniEditableGeometry::EndTransforming(const FTransform& Transform, cons
 	}
 }
 
+uint32 UHoudiniEditableGeometry::GetUploadLayoutKey(TConstArrayView<const UHoudiniEditableGeometry*> EditGeos)
+{
+	uint32 LayoutKey = GetTypeHash(EditGeos.Num());
+	for (const UHoudiniEditableGeometry* EditGeo : EditGeos)
+	{
+		LayoutKey = HashCombine(LayoutKey, GetTypeHash(EditGeo));
+		LayoutKey = HashCombine(LayoutKey, GetTypeHash(EditGeo->NumPoints()));
+		LayoutKey = HashCombine(LayoutKey, GetTypeHash(EditGeo->NumPrims()));
+		LayoutKey = HashCombine(LayoutKey, GetTypeHash(EditGeo->NumVertices()));
+	}
+
+	return LayoutKey;
+}
+
 const FString& UHoudiniEditableGeometry::ParseEditData(TConstArrayView<const UHoudiniEditableGeometry*> EditGeos,
 	size_t& OutNumVertices, size_t& OutNumPoints, size_t& OutNumPrims,
 	EHoudiniAttributeOwner& OutChangedClass,
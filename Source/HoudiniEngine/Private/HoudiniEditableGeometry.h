@@ -66,6 +66,8 @@ protected:
 	UPROPERTY(Transient, DuplicateTransient)
 	FString UnDeltaInfo;  // Use for undo, do NOT specify value before Transcation begin
 
+	uint64 UploadedCycles = 0;  // UpdateCycles when last uploaded, so that unchanged EditGeos could skip rewriting their data
+
 	void TriggerParentNodeToCook() const;
 
 public:
@@ -113,6 +115,7 @@ public:
 	{
 		Super::PreEditUndo();
 		DeltaInfo = UnDeltaInfo;
+		UploadedCycles = 0;
 	}
 
 	virtual void PostEditUndo() override
@@ -207,4 +210,11 @@ public:
 		TArray<UHoudiniParameterAttribute*>& OutPrimAttribs);
 
 	FORCEINLINE void ResetDeltaInfo() { DeltaInfo.Empty(); }
+
+	// Whether the data has changed since the last HapiUpload, should be called before ResetDeltaInfo()
+	FORCEINLINE bool NeedUpload() const { return HasChanged() || (UpdateCycles == 0) || (UploadedCycles != UpdateCycles); }
+
+	FORCEINLINE void MarkUploaded() { DeltaInfo.Empty(); UploadedCycles = UpdateCycles; }
+
+	static uint32 GetUploadLayoutKey(TConstArrayView<const UHoudiniEditableGeometry*> EditGeos);  // Changes when EditGeos or their element counts changed
 };
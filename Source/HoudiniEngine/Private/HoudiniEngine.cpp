@@ -12,6 +12,7 @@
 #include "HoudiniEngineSettings.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniApi.h"
+#include "HoudiniAsset.h"
 #include "HoudiniNode.h"
 #include "HoudiniInputs.h"
 #include "HoudiniOutputs.h"
@@ -19,11 +20,22 @@
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
+#define HOUDINI_ENGINE_MAX_SESSION_COUNT 32  // As FHoudiniEngine::LoadedAssets use uint32 as session bit mask
+
 FHoudiniEngine* FHoudiniEngine::HoudiniEngineInstance = nullptr;
 
+static thread_local int32 GHoudiniEngineCurrentSessionIdx = INDEX_NONE;  // Set by FHoudiniSessionScope, INDEX_NONE means outside any scope
+
+static FString GHoudiniEngineProcessIdentifiers[HOUDINI_ENGINE_MAX_SESSION_COUNT];  // Initialized in StartupModule on game thread, read-only afterwards
+
 void FHoudiniEngine::StartupModule()
 {
 	FHoudiniEngine::HoudiniEngineInstance = this;
+
+	// Shared memory of each session should NOT conflict, as node ids may be the same
+	GHoudiniEngineProcessIdentifiers[0] = FString::Printf(TEXT("_%d_"), FPlatformProcess::GetCurrentProcessId());
+	for (int32 SessionIdx = 1; SessionIdx < HOUDINI_ENGINE_MAX_SESSION_COUNT; ++SessionIdx)
+		GHoudiniEngineProcessIdentifiers[SessionIdx] = FString::Printf(TEXT("_%d_%d_"), FPlatformProcess::GetCurrentProcessId(), SessionIdx);
 	
 	ResetSession();
 
@@ -41,7 +53,7 @@ void FHoudiniEngine::ShutdownModule()
 	UnregisterNodeMovedDelegate();
 
 	if (!IsNullSession())
-		FHoudiniApi::CloseSession(&Session);
+		HapiStopSession();
 
 	FHoudiniApi::FinalizeHAPI();
 
@@ -211,7 +223,75 @@ bool FHoudiniEngine::IsSessionValid() const
 	if (IsNullSession())
 		return false;
 
-	return HAPI_RESULT_SUCCESS == FHoudiniApi::IsSessionValid(GetSession());
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::IsSessionValid(&Session))
+		return false;
+
+	FReadScopeLock ReadLock(SessionLock);
+	for (const HAPI_Session& PooledSession : PooledSessions)
+	{
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::IsSessionValid(&PooledSession))
+			return false;
+	}
+
+	return true;
+}
+
+const HAPI_Session* FHoudiniEngine::GetSession() const
+{
+	// Copy the session to thread local, as PooledSessions may be emptied by InvalidateSessionData() in game thread while cook tasks are running
+	static thread_local HAPI_Session GHoudiniEngineThreadSession = { HAPI_SESSION_MAX, -1 };
+
+	FReadScopeLock ReadLock(SessionLock);
+	if (GHoudiniEngineCurrentSessionIdx < 0)  // Node HAPI calls must in the session that node bound to, so we should open a FHoudiniSessionScope
+	{
+		ensureMsgf(PooledSessions.IsEmpty(), TEXT("HAPI called outside FHoudiniSessionScope, fall back to the main session"));
+		GHoudiniEngineThreadSession = Session;
+	}
+	else
+		GHoudiniEngineThreadSession = PooledSessions.IsValidIndex(GHoudiniEngineCurrentSessionIdx - 1) ? PooledSessions[GHoudiniEngineCurrentSessionIdx - 1] : Session;
+
+	return &GHoudiniEngineThreadSession;
+}
+
+int32 FHoudiniEngine::GetCurrentSessionIndex()
+{
+	return FMath::Max(GHoudiniEngineCurrentSessionIdx, 0);
+}
+
+int32 FHoudiniEngine::AcquireSessionIndex() const
+{
+	if (PooledSessions.IsEmpty())
+		return 0;
+
+	TArray<int32> NumSessionNodes;
+	NumSessionNodes.SetNumZeroed(PooledSessions.Num() + 1);
+	for (const TWeakObjectPtr<AHoudiniNode>& Node : CurrNodes)  // Nodes bound earlier in the same schedule pass are working but NOT instantiated yet, should also count them
+	{
+		if (Node.IsValid() && ((Node->GetNodeId() >= 0) || IsNodeWorking(Node)) && NumSessionNodes.IsValidIndex(Node->GetSessionIndex()))
+			++NumSessionNodes[Node->GetSessionIndex()];
+	}
+
+	int32 LeastSessionIdx = 0;
+	for (int32 SessionIdx = 1; SessionIdx < NumSessionNodes.Num(); ++SessionIdx)
+	{
+		if (NumSessionNodes[SessionIdx] < NumSessionNodes[LeastSessionIdx])
+			LeastSessionIdx = SessionIdx;
+	}
+
+	return LeastSessionIdx;
+}
+
+FHoudiniSessionScope::FHoudiniSessionScope(const int32& SessionIdx)
+{
+	PrevSessionIdx = GHoudiniEngineCurrentSessionIdx;
+	GHoudiniEngineCurrentSessionIdx = FMath::Max(SessionIdx, 0);
+}
+
+FHoudiniSessionScope::FHoudiniSessionScope(const AHoudiniNode* Node) : FHoudiniSessionScope(Node->GetSessionIndex()) {}
+
+FHoudiniSessionScope::~FHoudiniSessionScope()
+{
+	GHoudiniEngineCurrentSessionIdx = PrevSessionIdx;
 }
 
 void FHoudiniEngine::PreStartSession()
@@ -234,21 +314,8 @@ void FHoudiniEngine::PreStartSession()
 		FHoudiniEngine::Get().OnHoudiniSessionPreStartEvent.Broadcast();
 }
 
-bool FHoudiniEngine::HapiStartSession()
+static bool HapiCreateSession(HAPI_Session& OutSession)
 {
-	if (!FHoudiniApi::IsHAPIInitialized())
-		return false;
-
-	// Modify our PATH so that HARC will find HARS.exe
-	{
-		const FString HoudiniBinDir = GetHoudiniDir() + TEXT("/" HAPI_HOUDINI_BIN_DIR) + FPlatformMisc::GetPathVarDelimiter();
-		const FString OrigPathVar = FPlatformMisc::GetEnvironmentVariable(TEXT("PATH"));
-		if (!OrigPathVar.StartsWith(HoudiniBinDir))
-			FPlatformMisc::SetEnvironmentVar(TEXT("PATH"), *(HoudiniBinDir + OrigPathVar));
-	}
-
-	PreStartSession();
-
 	HAPI_ThriftServerOptions ServerOptions;
 	FHoudiniApi::ThriftServerOptions_Init(&ServerOptions);
 	ServerOptions.autoClose = true;
@@ -287,21 +354,72 @@ bool FHoudiniEngine::HapiStartSession()
 	{
 		SessionInfo.sharedMemoryBufferType = HAPI_THRIFT_SHARED_MEMORY_FIXED_LENGTH_BUFFER;
 		SessionInfo.sharedMemoryBufferSize = HAPI_Int64(Settings->SharedMemoryBufferSize);
-		if (HAPI_RESULT_SUCCESS != FHoudiniApi::CreateThriftSharedMemorySession(&Session, HARSName.c_str(), &SessionInfo))
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::CreateThriftSharedMemorySession(&OutSession, HARSName.c_str(), &SessionInfo))
 			return false;
 	}
 	break;
 	default:
 	{
-		if (HAPI_RESULT_SUCCESS != FHoudiniApi::CreateThriftNamedPipeSession(&Session, HARSName.c_str(), &SessionInfo))
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::CreateThriftNamedPipeSession(&OutSession, HARSName.c_str(), &SessionInfo))
 			return false;
 	}
 	break;
 	}
 
+	return true;
+}
+
+bool FHoudiniEngine::HapiStartSession()
+{
+	if (!FHoudiniApi::IsHAPIInitialized())
+		return false;
+
+	// Modify our PATH so that HARC will find HARS.exe
+	{
+		const FString HoudiniBinDir = GetHoudiniDir() + TEXT("/" HAPI_HOUDINI_BIN_DIR) + FPlatformMisc::GetPathVarDelimiter();
+		const FString OrigPathVar = FPlatformMisc::GetEnvironmentVariable(TEXT("PATH"));
+		if (!OrigPathVar.StartsWith(HoudiniBinDir))
+			FPlatformMisc::SetEnvironmentVar(TEXT("PATH"), *(HoudiniBinDir + OrigPathVar));
+	}
+
+	PreStartSession();
+
+	HAPI_Session MainSession = { HAPI_SESSION_MAX, -1 };
+	if (!HapiCreateSession(MainSession))
+		return false;
+
+	{
+		FWriteScopeLock WriteLock(SessionLock);
+		Session = MainSession;
+	}
+
 	bSessionSync = false;
 
-	return HapiInitializeSession();
+	if (!HapiInitializeSession(MainSession))
+		return false;
+
+	// Start the extra sessions for cooking nodes in parallel
+	const int32 NumSessions = FMath::Clamp(GetDefault<UHoudiniEngineSettings>()->NumSessions, 1, HOUDINI_ENGINE_MAX_SESSION_COUNT);
+	for (int32 SessionIdx = 1; SessionIdx < NumSessions; ++SessionIdx)
+	{
+		HAPI_Session PooledSession = { HAPI_SESSION_MAX, -1 };
+		if (!HapiCreateSession(PooledSession))  // Maybe no more licenses, then we just cook with the started sessions
+		{
+			UE_LOG(LogHoudiniEngine, Warning, TEXT("Failed to start session %d, only %d session(s) will be used"), SessionIdx, SessionIdx);
+			break;
+		}
+
+		if (!HapiInitializeSession(PooledSession))
+		{
+			FHoudiniApi::CloseSession(&PooledSession);
+			break;
+		}
+
+		FWriteScopeLock WriteLock(SessionLock);
+		PooledSessions.Add(PooledSession);
+	}
+
+	return true;
 }
 
 FORCEINLINE static bool StartHoudiniProcess(const FString& HoudiniDir, const TCHAR* HoudiniArg)
@@ -338,7 +456,7 @@ bool FHoudiniEngine::HapiStartSessionSync()
 			return true;
 
 		// has a HARS running in the background, so we need invalidate it first
-		FHoudiniApi::CloseSession(&Session);
+		HapiStopSession();
 
 		InvalidateSessionData();  // will reset FHoudiniEngine::NumWorkingTasks = 0
 
@@ -349,6 +467,7 @@ bool FHoudiniEngine::HapiStartSessionSync()
 
 	bSessionSync = false;
 
+	HAPI_Session SyncSession = { HAPI_SESSION_MAX, -1 };
 	HAPI_SessionInfo SessionInfo;
 	FHoudiniApi::SessionInfo_Init(&SessionInfo);
 
@@ -361,7 +480,7 @@ bool FHoudiniEngine::HapiStartSessionSync()
 		SessionInfo.sharedMemoryBufferSize = HAPI_Int64(Settings->SharedMemoryBufferSize);
 
 		// First we should check whether there is already an open houdini
-		if (HAPI_RESULT_SUCCESS == FHoudiniApi::CreateThriftSharedMemorySession(&Session, "hapi_session_sync", &SessionInfo))
+		if (HAPI_RESULT_SUCCESS == FHoudiniApi::CreateThriftSharedMemorySession(&SyncSession, "hapi_session_sync", &SessionInfo))
 			bSessionSync = true;
 		else if (StartHoudiniProcess(GetHoudiniDir(), *FString::Printf(TEXT("-hess=shared:fixed:%d:hapi_session_sync"), int32(Settings->SharedMemoryBufferSize))))
 		{
@@ -369,7 +488,7 @@ bool FHoudiniEngine::HapiStartSessionSync()
 			{
 				FPlatformProcess::SleepNoStats(1.0f);
 
-				if (HAPI_RESULT_SUCCESS == FHoudiniApi::CreateThriftSharedMemorySession(&Session, "hapi_session_sync", &SessionInfo))
+				if (HAPI_RESULT_SUCCESS == FHoudiniApi::CreateThriftSharedMemorySession(&SyncSession, "hapi_session_sync", &SessionInfo))
 				{
 					bSessionSync = true;
 					break;
@@ -381,7 +500,7 @@ bool FHoudiniEngine::HapiStartSessionSync()
 	default:
 	{
 		// First we should check whether there is already an open houdini
-		if (HAPI_RESULT_SUCCESS == FHoudiniApi::CreateThriftNamedPipeSession(&Session, "hapi_session_sync", &SessionInfo))
+		if (HAPI_RESULT_SUCCESS == FHoudiniApi::CreateThriftNamedPipeSession(&SyncSession, "hapi_session_sync", &SessionInfo))
 			bSessionSync = true;
 		else if (StartHoudiniProcess(GetHoudiniDir(), TEXT("-hess=pipe:hapi_session_sync")))
 		{
@@ -389,7 +508,7 @@ bool FHoudiniEngine::HapiStartSessionSync()
 			{
 				FPlatformProcess::SleepNoStats(1.0f);
 
-				if (HAPI_RESULT_SUCCESS == FHoudiniApi::CreateThriftNamedPipeSession(&Session, "hapi_session_sync", &SessionInfo))
+				if (HAPI_RESULT_SUCCESS == FHoudiniApi::CreateThriftNamedPipeSession(&SyncSession, "hapi_session_sync", &SessionInfo))
 				{
 					bSessionSync = true;
 					break;
@@ -400,7 +519,15 @@ bool FHoudiniEngine::HapiStartSessionSync()
 	break;
 	}
 	
-	return bSessionSync ? HapiInitializeSession() : false;
+	if (!bSessionSync)
+		return false;
+
+	{
+		FWriteScopeLock WriteLock(SessionLock);
+		Session = SyncSession;
+	}
+
+	return HapiInitializeSession(SyncSession);
 }
 
 
@@ -447,6 +574,7 @@ bool FHoudiniEngine::HapiSaveSceneToFile(const FString& FilePath, bool& bOutSucc
 	bOutSuccess = false;
 
 	// Save HIP file through Engine.
+	const FHoudiniSessionScope SessionScope(0);  // Save the main session
 	HAPI_SESSION_FAIL_RETURN(FHoudiniApi::SaveHIPFile(FHoudiniEngine::Get().GetSession(),
 		TCHAR_TO_UTF8(*FilePath), false));
 
@@ -480,7 +608,7 @@ bool FHoudiniEngine::HapiOpenSceneInHoudini()
 	return true;
 }
 
-bool FHoudiniEngine::HapiInitializeSession()
+bool FHoudiniEngine::HapiInitializeSession(const HAPI_Session& InSession)
 {
 	HAPI_CookOptions CookOptions;
 	FHoudiniApi::CookOptions_Init(&CookOptions);
@@ -500,7 +628,7 @@ bool FHoudiniEngine::HapiInitializeSession()
 	CookOptions.handleSpherePartTypes = false;
 	
 	HAPI_Result Result = FHoudiniApi::Initialize(
-		&Session,
+		&InSession,
 		&CookOptions,
 		GetDefault<UHoudiniEngineSettings>()->bVerbose,  // Use cook thread if need display detailed cook and instantiate progress
 		-1,
@@ -516,16 +644,33 @@ bool FHoudiniEngine::HapiInitializeSession()
 	// Set enviroment variables
 	ULevel* Level = FHoudiniEngineUtils::GetCurrentLevel();
 	if (IsValid(Level))
-		HAPI_SESSION_FAIL_RETURN(FHoudiniApi::SetServerEnvString(&Session,
+		HAPI_SESSION_FAIL_RETURN(FHoudiniApi::SetServerEnvString(&InSession,
 			HAPI_ENV_CLIENT_SCENE_PATH, TCHAR_TO_UTF8(*Level->GetPathName())));
-	HAPI_SESSION_FAIL_RETURN(FHoudiniApi::SetServerEnvString(&Session,
+	HAPI_SESSION_FAIL_RETURN(FHoudiniApi::SetServerEnvString(&InSession,
 		HAPI_ENV_HOUDINI_ENGINE_FOLDER, TCHAR_TO_UTF8(*GetDefault<UHoudiniEngineSettings>()->HoudiniEngineFolder)));
 
 	return true;
 }
 
+bool FHoudiniEngine::HapiSetServerEnvString(const char* VarName, const FString& Value) const
+{
+	const std::string ValueStr = TCHAR_TO_UTF8(*Value);
+	HAPI_SESSION_FAIL_RETURN(FHoudiniApi::SetServerEnvString(&Session, VarName, ValueStr.c_str()));
+	FReadScopeLock ReadLock(SessionLock);
+	for (const HAPI_Session& PooledSession : PooledSessions)
+		HAPI_SESSION_FAIL_RETURN(FHoudiniApi::SetServerEnvString(&PooledSession, VarName, ValueStr.c_str()));
+
+	return true;
+}
+
 bool FHoudiniEngine::HapiStopSession() const
 {
+	{
+		FReadScopeLock ReadLock(SessionLock);
+		for (const HAPI_Session& PooledSession : PooledSessions)
+			FHoudiniApi::CloseSession(&PooledSession);
+	}
+
 	return (HAPI_RESULT_SUCCESS == FHoudiniApi::CloseSession(&Session));
 }
 
@@ -578,8 +723,14 @@ void FHoudiniEngine::InvalidateSessionData()
 	}
 
 	bSessionSync = false;
+	{
+		FReadScopeLock ReadLock(SessionLock);
+		for (const HAPI_Session& PooledSession : PooledSessions)  // The extra sessions may still alive, we should close them
+			FHoudiniApi::CloseSession(&PooledSession);
+	}
 	ResetSession();
 	LoadedAssets.Empty();
+	UHoudiniInputStaticMesh::InvalidateImportCache();
 
 	for (const TWeakObjectPtr<AHoudiniNode>& Node : CurrNodes)
 	{
@@ -588,6 +739,9 @@ void FHoudiniEngine::InvalidateSessionData()
 	}
 
 	NumWorkingTasks = 0;
+	NodeWorkingTasks.Empty();
+	NumNodeWorkingTasks = 0;
+	CookBatchStartTime = -1.0;
 }
 
 bool FHoudiniEngine::AllowEdit() const
@@ -595,18 +749,61 @@ bool FHoudiniEngine::AllowEdit() const
 	return (NumWorkingTasks == 0) && FHoudiniApi::IsHAPIInitialized();
 }
 
+void FHoudiniEngine::StartHoudiniTask(const AHoudiniNode* Node)
+{
+	++NumWorkingTasks;
+	++NumNodeWorkingTasks;
+	++NodeWorkingTasks.FindOrAdd(Node);
+}
+
+void FHoudiniEngine::FinishHoudiniTask(const AHoudiniNode* Node)
+{
+	FinishHoudiniTask();
+	if (uint32* NumTasksPtr = NodeWorkingTasks.Find(Node))
+	{
+		if (NumNodeWorkingTasks >= 1)
+			--NumNodeWorkingTasks;
+
+		if (*NumTasksPtr <= 1)
+			NodeWorkingTasks.Remove(Node);
+		else
+			--(*NumTasksPtr);
+	}
+
+	if (NodeWorkingTasks.IsEmpty())  // All nodes finished cook
+		RecoverEngineFrameRate();
+}
+
+bool FHoudiniEngine::DispatchCook(AHoudiniNode* Node)
+{
+	if (NodeWorkingTasks.IsEmpty())  // Cache when a new batch of cook triggered
+		CacheNameActorMap();
+
+	// Inputs are uploaded here on game thread, as input builders read actors, components and assets, only HAPI cook will run on the launched task
+	if (!Node->HapiAsyncProcess(false))
+	{
+		InvalidateSessionData();
+		return false;
+	}
+
+	return true;
+}
+
 bool FHoudiniEngine::Tick(float DeltaTime)
 {
-	if (!AllowEdit())  // Pause Tick when async houdini task running
+	if (!FHoudiniApi::IsHAPIInitialized())
+		return true;
+
+	if (NumWorkingTasks > NumNodeWorkingTasks)  // Pause Tick when exclusive async houdini task running, such as starting session
 		return true;
 
 	// Check whether NameActorLoadedMap should update
 	if (CachedNameActorMap.IsEmpty() && CurrWorld.IsValid() && !CurrNodes.IsEmpty())
 		CacheNameActorMap();
 
-	// Check is session valid once per second
+	// Check is session valid once per second, only when idle, as HAPI calls will be blocked by the cooking nodes
 	SessionCheckDeltaTime += DeltaTime;
-	if (SessionCheckDeltaTime >= 1.0f)
+	if ((SessionCheckDeltaTime >= 1.0f) && (NumWorkingTasks == 0))
 	{
 		SessionCheckDeltaTime = 0.0f;
 		// Check Not IsNullSession()
@@ -615,42 +812,171 @@ bool FHoudiniEngine::Tick(float DeltaTime)
 			InvalidateSessionData();
 	}
 
-	// Check has node changed
+	if (bPendingWarmUp && (NumWorkingTasks == 0))
+	{
+		WarmUp();
+		return true;
+	}
+
+	ScheduleCooks();
+
+	return true;
+}
+
+void FHoudiniEngine::WarmUp()
+{
+	bPendingWarmUp = false;
+
+	if (!GetDefault<UHoudiniEngineSettings>()->bWarmUpOnLevelOpened || IsRunningCommandlet())
+		return;
+
+	TArray<TWeakObjectPtr<UHoudiniAsset>> Assets;
+	for (const TWeakObjectPtr<AHoudiniNode>& Node : CurrNodes)
+	{
+		if (Node.IsValid() && IsValid(Node->GetAsset()))
+			Assets.AddUnique(Node->GetAsset());
+	}
+
+	if (Assets.IsEmpty())
+		return;
+
+	StartHoudiniTask();  // Exclusive task, as sessions will be started and hdas will be loaded in background, so cooks and edits should wait
+	HoudiniAsyncTaskMessageEvent.Broadcast(LOCTEXT("WarmUp", HAPI_MESSAGE_WARM_UP));
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [Assets]
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			bool bPreloadFailed = false;
+			if (FHoudiniEngine::Get().IsSessionValid() || FHoudiniEngine::Get().HapiStartSession())
+			{
+				if (FHoudiniEngine::Get().HapiPreloadAssets(Assets))
+					UE_LOG(LogHoudiniEngine, Log, TEXT("Warm up: %d HDA(s) loaded, %.3f (s)"), Assets.Num(), FPlatformTime::Seconds() - StartTime);
+				else
+					bPreloadFailed = true;
+			}
+
+			AsyncTask(ENamedThreads::GameThread, [bPreloadFailed]()
+				{
+					FHoudiniEngine::Get().FinishHoudiniAsyncTaskMessage();
+					if (bPreloadFailed)
+						FHoudiniEngine::Get().InvalidateSessionData();  // will reset FHoudiniEngine::NumWorkingTasks = 0
+					else
+						FHoudiniEngine::Get().FinishHoudiniTask();
+				});
+		});
+}
+
+bool FHoudiniEngine::HapiPreloadAssets(const TArray<TWeakObjectPtr<UHoudiniAsset>>& Assets)
+{
+	for (int32 SessionIdx = 0; SessionIdx <= PooledSessions.Num(); ++SessionIdx)
+	{
+		const FHoudiniSessionScope SessionScope(SessionIdx);
+		for (const TWeakObjectPtr<UHoudiniAsset>& Asset : Assets)
+		{
+			TArray<FString> AvailableAssetNames;
+			if (Asset.IsValid() && !Asset->HapiLoad(AvailableAssetNames))
+				return false;
+		}
+	}
+
+	return true;
+}
+
+void FHoudiniEngine::ScheduleCooks()
+{
+	if (NumWorkingTasks > NumNodeWorkingTasks)
+		return;
+
+	// Concurrent cooks in the same session just interleave HAPI calls, so never exceed num of sessions
+	const int32 MaxConcurrentCooks = FMath::Clamp(GetDefault<UHoudiniEngineSettings>()->MaxConcurrentCooks, 1, PooledSessions.Num() + 1);
+	if (NodeWorkingTasks.Num() >= MaxConcurrentCooks)
+		return;
+
+	// Gather the nodes that could start cook now, a node is ready only when all its upstream nodes finished
+	TArray<AHoudiniNode*> ReadyNodes;
+	AHoudiniNode* FirstPendingNode = nullptr;
 	for (const TWeakObjectPtr<AHoudiniNode>& CurrNode : CurrNodes)
 	{
 		if (!CurrNode.IsValid())
 			continue;
 
 		AHoudiniNode* Node = CurrNode.Get();
-		if (Node->NeedCook())
-		{
-			if (!IsSessionValid())  // We should create a session first
+		if (!Node->NeedCook() || IsNodeWorking(Node))
+			continue;
+
+		if (!FirstPendingNode)
+			FirstPendingNode = Node;
+
+		if (!Node->NeedWaitUpstreamCookFinish())
+			ReadyNodes.Add(Node);
+	}
+
+	// If no node is ready and nothing is cooking, then upstream nodes may outside current world, or nodes are linked as a loop,
+	// so we just cook the first one, and let AHoudiniNode::HapiCookUpstream to resolve it
+	if (ReadyNodes.IsEmpty() && FirstPendingNode && NodeWorkingTasks.IsEmpty())
+		ReadyNodes.Add(FirstPendingNode);
+
+	if (ReadyNodes.IsEmpty())
+		return;
+
+	if ((NumWorkingTasks == 0) && !IsSessionValid())  // We should create a session first
+	{
+		StartHoudiniTask();
+		HoudiniAsyncTaskMessageEvent.Broadcast(LOCTEXT("StartSession", HAPI_MESSAGE_START_SESSION));
+		UE::Tasks::Launch(UE_SOURCE_LOCATION, []
 			{
-				StartHoudiniTask();
-				HoudiniAsyncTaskMessageEvent.Broadcast(LOCTEXT("StartSession", HAPI_MESSAGE_START_SESSION));
-				UE::Tasks::Launch(UE_SOURCE_LOCATION, []
+				FHoudiniEngine::Get().HapiStartSession();
+				AsyncTask(ENamedThreads::GameThread, []()
 					{
-						FHoudiniEngine::Get().HapiStartSession();
-						AsyncTask(ENamedThreads::GameThread, []()
-							{
-								FHoudiniEngine::Get().HoudiniAsyncTaskMessageEvent.Broadcast(FText::GetEmpty());
-								FHoudiniEngine::Get().FinishHoudiniTask();  // Finish task, so that tick will trigger the actual cook process
-							});
+						FHoudiniEngine::Get().HoudiniAsyncTaskMessageEvent.Broadcast(FText::GetEmpty());
+						FHoudiniEngine::Get().FinishHoudiniTask();  // Finish task, so that tick will trigger the actual cook process
 					});
-			}
-			else  // Actual cook process
-			{
-				CacheNameActorMap();
-				HOUDINI_FAIL_INVALIDATE(Node->HapiAsyncProcess(false));
-			}
+			});
 
-			return true;  // Do NOT start multi nodes to cook at same time
-		}
+		return;
 	}
 
-	return true;
+	// Actual cook process
+	for (AHoudiniNode* Node : ReadyNodes)
+	{
+		if (!DispatchCook(Node))  // Session has been invalidated
+			break;
+
+		if ((NodeWorkingTasks.Num() >= MaxConcurrentCooks) || (NumWorkingTasks > NumNodeWorkingTasks))
+			break;
+	}
 }
 
+void FHoudiniEngine::RecordCookStart()
+{
+	if (CookBatchStartTime < 0.0)
+	{
+		CookBatchStartTime = FPlatformTime::Seconds();
+		CookBatchCookTime = 0.0;
+		CookBatchOutputTime = 0.0;
+		NumCookBatchNodes = 0;
+		UHoudiniInputStaticMesh::RequestImportCacheSweep();  // Nodes may have been destroyed since last batch
+	}
+}
+
+void FHoudiniEngine::RecordCookFinish(const double& CookTime, const double& OutputTime)
+{
+	if (CookBatchStartTime < 0.0)
+		return;
+
+	CookBatchCookTime += CookTime;
+	CookBatchOutputTime += OutputTime;
+	++NumCookBatchNodes;
+
+	if (NodeWorkingTasks.IsEmpty())  // All nodes finished, so the stage time that exceeds wall time is overlapped
+	{
+		const double WallTime = FPlatformTime::Seconds() - CookBatchStartTime;
+		UE_LOG(LogHoudiniEngine, Log, TEXT("Cook %d Node(s): WALL %.3f (s), COOK %.3f (s), OUTPUT %.3f (s), OVERLAPPED %.3f (s)"),
+			NumCookBatchNodes, WallTime, CookBatchCookTime, CookBatchOutputTime, FMath::Max(CookBatchCookTime + CookBatchOutputTime - WallTime, 0.0));
+		CookBatchStartTime = -1.0;
+	}
+}
+
+
 void FHoudiniEngine::StartTick()
 {
 	if (!TickerHandle.IsValid())
@@ -698,12 +1024,7 @@ const FString& FHoudiniEngine::GetPluginDir()
 
 const FString& FHoudiniEngine::GetProcessIdentifier()
 {
-	static FString ProcessIdentifier;
-
-	if (ProcessIdentifier.IsEmpty())
-		ProcessIdentifier = FString::Printf(TEXT("_%d_"), FPlatformProcess::GetCurrentProcessId());
-
-	return ProcessIdentifier;
+	return GHoudiniEngineProcessIdentifiers[FMath::Clamp(GetCurrentSessionIndex(), 0, HOUDINI_ENGINE_MAX_SESSION_COUNT - 1)];
 }
 
 void FHoudiniEngine::RegisterWorldDestroyedDelegate()
@@ -766,6 +1087,7 @@ void FHoudiniEngine::RegisterNode(AHoudiniNode* Node)
 		}
 		CurrNodes.Empty();
 		CurrWorld = Node->GetWorld();
+		bPendingWarmUp = true;
 		CachedNameActorMap.Empty();  // CachedNameActorLoadedMap should Update in next tick, as this tick does NOT load actors completely
 	}
 
@@ -7,6 +7,7 @@
 #include "HoudiniEngineSettings.h"
 #include "HoudiniApi.h"
 #include "HoudiniEngineCommon.h"
+#include "HoudiniOperatorUtils.h"
 
 
 static FString GetValidHoudiniDir(FString HoudiniDir)
@@ -203,7 +204,10 @@ void FHoudiniEngineUtils::UnmapSharedMemory(const void* SHM)
 void FHoudiniEngineUtils::CloseSharedMemoryHandle(const size_t& Handle)
 {
 	if (Handle)
+	{
+		FHoudiniSharedMemoryArena::Release(Handle);
 		CloseHandle(HANDLE(Handle));
+	}
 }
 
 // Of course, Windows defines its own GetGeoInfo, so we need undefine to avoid collision
@@ -329,6 +333,7 @@ void FHoudiniEngineUtils::CloseSharedMemoryHandle(const size_t& Handle)
 {
 	if (Handle)
 	{
+		FHoudiniSharedMemoryArena::Release(Handle);
 		close(int(Handle - 1));
 		std::string shm_path;
 		if (GHoudiniEngineSHMPathMap.RemoveAndCopyValue(int(Handle - 1), shm_path))
@@ -48,6 +48,7 @@ void UHoudiniEngineSettings::PostEditChangeProperty(FPropertyChangedEvent& Prope
 	}
 	else if ((PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UHoudiniEngineSettings, SessionType)) ||
 		(PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UHoudiniEngineSettings, SharedMemoryBufferSize)) ||
+		(PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UHoudiniEngineSettings, NumSessions)) ||
 		(PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UHoudiniEngineSettings, bVerbose)))
 	{
 		if (!FHoudiniEngine::Get().IsNullSession())
@@ -58,10 +59,7 @@ void UHoudiniEngineSettings::PostEditChangeProperty(FPropertyChangedEvent& Prope
 	{
 		if (!FHoudiniEngine::Get().IsNullSession())  // Update houdini engine folder env var
 		{
-			const HAPI_Result HapiResult = FHoudiniApi::SetServerEnvString(FHoudiniEngine::Get().GetSession(),
-				HAPI_ENV_HOUDINI_ENGINE_FOLDER, TCHAR_TO_UTF8(*HoudiniEngineFolder));
-			if (HAPI_SESSION_INVALID_RESULT(HapiResult))
-				FHoudiniEngine::Get().InvalidateSessionData();
+			HOUDINI_FAIL_INVALIDATE(FHoudiniEngine::Get().HapiSetServerEnvString(HAPI_ENV_HOUDINI_ENGINE_FOLDER, HoudiniEngineFolder));
 		}
 	}
 
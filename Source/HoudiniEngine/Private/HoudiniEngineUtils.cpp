@@ -617,6 +617,137 @@ bool FHoudiniEngineUtils::HapiGetStringAttributeValue(const int32& NodeId, const
 }
 
 
+const FHoudiniAttributeFetchPlanner::FFetchEntry* FHoudiniAttributeFetchPlanner::FindEntry(const char* AttribName, const EFetchType& Type, const int32& TupleSize) const
+{
+    return Entries.FindByPredicate([AttribName, Type, TupleSize](const FFetchEntry& Entry)
+        {
+            return (Entry.Type == Type) && (Entry.TupleSize == TupleSize) && (Entry.Name == AttribName);
+        });
+}
+
+void FHoudiniAttributeFetchPlanner::Request(const char* AttribName, const EFetchType& Type, const int32& TupleSize, const HAPI_AttributeOwner& PreferOwner)
+{
+    if (FindEntry(AttribName, Type, TupleSize))  // Coalesce the same requests
+        return;
+
+    FFetchEntry& NewEntry = Entries.AddDefaulted_GetRef();
+    NewEntry.Name = AttribName;
+    NewEntry.Type = Type;
+    NewEntry.TupleSize = TupleSize;
+    NewEntry.Owner = FHoudiniEngineUtils::QueryAttributeOwner(AttribNames, PartInfo.attributeCounts, NewEntry.Name, PreferOwner);
+    NewEntry.bFetched = (NewEntry.Owner == HAPI_ATTROWNER_INVALID);  // Attribute NOT exists, so we need NOT fetch it
+}
+
+void FHoudiniAttributeFetchPlanner::RequestFloat(const char* AttribName, const int32& DesiredTupleSize, const HAPI_AttributeOwner& PreferOwner)
+{
+    Request(AttribName, EFetchType::Float, DesiredTupleSize, PreferOwner);
+}
+
+void FHoudiniAttributeFetchPlanner::RequestEnum(const char* AttribName, const HAPI_AttributeOwner& PreferOwner)
+{
+    Request(AttribName, EFetchType::Enum, 1, PreferOwner);
+}
+
+void FHoudiniAttributeFetchPlanner::RequestString(const char* AttribName, const HAPI_AttributeOwner& PreferOwner)
+{
+    Request(AttribName, EFetchType::String, 1, PreferOwner);
+}
+
+bool FHoudiniAttributeFetchPlanner::HapiFetch()
+{
+    TSet<HAPI_StringHandle> NewSHs;
+    for (FFetchEntry& Entry : Entries)
+    {
+        if (Entry.bFetched)
+            continue;
+
+        Entry.bFetched = true;
+
+        HAPI_AttributeInfo AttribInfo;
+        HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetAttributeInfo(FHoudiniEngine::Get().GetSession(), NodeId, PartInfo.id,
+            Entry.Name.c_str(), Entry.Owner, &AttribInfo));
+
+        const EHoudiniStorageType StorageType = FHoudiniEngineUtils::ConvertStorageType(AttribInfo.storage);
+        if (!AttribInfo.exists || FHoudiniEngineUtils::IsArray(AttribInfo.storage))
+            Entry.Owner = HAPI_ATTROWNER_INVALID;
+        else if (Entry.Type == EFetchType::Float)
+        {
+            if ((StorageType == EHoudiniStorageType::Float) && (AttribInfo.tupleSize >= Entry.TupleSize))
+            {
+                AttribInfo.tupleSize = Entry.TupleSize;
+                Entry.FloatData.SetNumUninitialized(AttribInfo.count * AttribInfo.tupleSize);
+                HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetAttributeFloatData(FHoudiniEngine::Get().GetSession(), NodeId, PartInfo.id,
+                    Entry.Name.c_str(), &AttribInfo, -1, Entry.FloatData.GetData(), 0, AttribInfo.count));
+            }
+            else
+                Entry.Owner = HAPI_ATTROWNER_INVALID;
+        }
+        else if (Entry.Type == EFetchType::Enum)
+        {
+            if ((StorageType == EHoudiniStorageType::Int) || (StorageType == EHoudiniStorageType::Float))
+            {
+                AttribInfo.tupleSize = 1;  // The tupleSize should be 1 when used for enum
+                Entry.EnumData.SetNumUninitialized(AttribInfo.count);
+                HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetAttributeInt8Data(FHoudiniEngine::Get().GetSession(), NodeId, PartInfo.id,
+                    Entry.Name.c_str(), &AttribInfo, -1, Entry.EnumData.GetData(), 0, AttribInfo.count));
+            }
+            else
+                Entry.Owner = HAPI_ATTROWNER_INVALID;
+        }
+        else if (AttribInfo.storage == HAPI_STORAGETYPE_STRING)
+        {
+            Entry.SHs.SetNumUninitialized(AttribInfo.count);
+            HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetAttributeStringData(FHoudiniEngine::Get().GetSession(), NodeId, PartInfo.id,
+                Entry.Name.c_str(), &AttribInfo, Entry.SHs.GetData(), 0, AttribInfo.count));
+            for (const HAPI_StringHandle& SH : Entry.SHs)
+            {
+                if (!SHStringMap.Contains(SH))
+                    NewSHs.Add(SH);
+            }
+        }
+        else
+            Entry.Owner = HAPI_ATTROWNER_INVALID;
+    }
+
+    // Convert string handles of all string attributes in one batch
+    if (!NewSHs.IsEmpty())
+    {
+        const TArray<HAPI_StringHandle> UniqueSHs = NewSHs.Array();
+        TArray<FString> UniqueStrs;
+        HOUDINI_FAIL_RETURN(FHoudiniEngineUtils::HapiConvertUniqueStringHandles(UniqueSHs, UniqueStrs));
+        for (int32 UniqueIdx = 0; UniqueIdx < UniqueSHs.Num(); ++UniqueIdx)
+            SHStringMap.Add(UniqueSHs[UniqueIdx], UniqueStrs[UniqueIdx]);
+    }
+
+    return true;
+}
+
+static const TArray<float> EmptyFloatData;
+static const TArray<int8> EmptyEnumData;
+static const TArray<HAPI_StringHandle> EmptySHs;
+
+const TArray<float>& FHoudiniAttributeFetchPlanner::GetFloatData(const char* AttribName, const int32& DesiredTupleSize, HAPI_AttributeOwner& OutOwner) const
+{
+    const FFetchEntry* Entry = FindEntry(AttribName, EFetchType::Float, DesiredTupleSize);
+    OutOwner = Entry ? Entry->Owner : HAPI_ATTROWNER_INVALID;
+    return (OutOwner == HAPI_ATTROWNER_INVALID) ? EmptyFloatData : Entry->FloatData;
+}
+
+const TArray<int8>& FHoudiniAttributeFetchPlanner::GetEnumData(const char* AttribName, HAPI_AttributeOwner& OutOwner) const
+{
+    const FFetchEntry* Entry = FindEntry(AttribName, EFetchType::Enum, 1);
+    OutOwner = Entry ? Entry->Owner : HAPI_ATTROWNER_INVALID;
+    return (OutOwner == HAPI_ATTROWNER_INVALID) ? EmptyEnumData : Entry->EnumData;
+}
+
+const TArray<HAPI_StringHandle>& FHoudiniAttributeFetchPlanner::GetStringHandles(const char* AttribName, HAPI_AttributeOwner& OutOwner) const
+{
+    const FFetchEntry* Entry = FindEntry(AttribName, EFetchType::String, 1);
+    OutOwner = Entry ? Entry->Owner : HAPI_ATTROWNER_INVALID;
+    return (OutOwner == HAPI_ATTROWNER_INVALID) ? EmptySHs : Entry->SHs;
+}
+
+
 bool FHoudiniEngineUtils::HapiGetPrimitiveGroupNames(const HAPI_GeoInfo& GeoInfo, const HAPI_PartInfo& PartInfo, TArray<std::string>& OutPrimGroupNames)
 {
     int32 NumPrimGroups = GeoInfo.primitiveGroupCount;
@@ -858,6 +989,23 @@ HAPI_TransformEuler FHoudiniEngineUtils::ConvertTransform(const FTransform& Tran
     return HapiTransformEuler;
 }
 
+void FHoudiniEngineUtils::ConvertHapiTransforms(const HAPI_Transform* HapiTransforms, FTransform* OutTransforms, const int32& Num)
+{
+    // FTransform already keeps its components in vector registers, so just construct in place by batches, without any intermediate arrays
+    ParallelFor(FMath::DivideAndRoundUp(Num, HOUDINI_TRANSFORM_CONVERT_BATCH_SIZE), [&](int32 BatchIdx)
+        {
+            const int32 EndIdx = FMath::Min((BatchIdx + 1) * HOUDINI_TRANSFORM_CONVERT_BATCH_SIZE, Num);
+            for (int32 Idx = BatchIdx * HOUDINI_TRANSFORM_CONVERT_BATCH_SIZE; Idx < EndIdx; ++Idx)
+            {
+                const HAPI_Transform& HapiTransform = HapiTransforms[Idx];
+                new (OutTransforms + Idx) FTransform(  // Swap Y/Z and negate W of quaternion
+                    FQuat(HapiTransform.rotationQuaternion[0], HapiTransform.rotationQuaternion[2], HapiTransform.rotationQuaternion[1], -HapiTransform.rotationQuaternion[3]),
+                    FVector(HapiTransform.position[0], HapiTransform.position[2], HapiTransform.position[1]) * POSITION_SCALE_TO_UNREAL_F,
+                    FVector(HapiTransform.scale[0], HapiTransform.scale[2], HapiTransform.scale[1]));
+            }
+        });
+}
+
 int32 FHoudiniEngineUtils::BinarySearch(const TArray<int32>& SortedArray, const int32& Target)
 {
     int32 T0 = -1, T1 = SortedArray.Num();
@@ -7,6 +7,10 @@
 #include "Engine/SimpleConstructionScript.h"
 #include "Engine/SCS_Node.h"
 #include "JsonObjectConverter.h"
+#include "HAL/FileManager.h"
+#include "Misc/PackageName.h"
+#include "Serialization/ArchiveObjectCrc32.h"
+#include "UObject/PropertyIterator.h"
 
 #include "HoudiniApi.h"
 #include "HoudiniEngine.h"
@@ -23,6 +27,73 @@ void UHoudiniInputHolder::RequestReimport()
 	((AHoudiniNode*)(GetOuter()->GetOuter()))->TriggerCookByInput((const UHoudiniInput*)GetOuter());
 }
 
+uint32 UHoudiniInputHolder::GetTransformHash(const FTransform& Transform)
+{
+	const FQuat Rotation = Transform.GetRotation();
+	const FVector Translation = Transform.GetTranslation();
+	const FVector Scale = Transform.GetScale3D();
+	uint32 Hash = FCrc::MemCrc32(&Rotation, sizeof(FQuat));
+	Hash = HashCombine(Hash, FCrc::MemCrc32(&Translation, sizeof(FVector)));
+	return HashCombine(Hash, FCrc::MemCrc32(&Scale, sizeof(FVector)));
+}
+
+uint32 UHoudiniInputHolder::GetAssetContentHash(const FSoftObjectPath& AssetPath)
+{
+	const FString PackageName = AssetPath.GetLongPackageName();
+	if (const UPackage* Package = FindPackage(nullptr, *PackageName))
+	{
+		if (Package->IsDirty())  // Has unsaved modifications
+			return 0;
+	}
+
+	FString PackageFilePath;
+	if (!FPackageName::DoesPackageExist(PackageName, &PackageFilePath))
+		return 0;
+
+	return HashCombine(GetTypeHash(AssetPath.ToString()), GetTypeHash(IFileManager::Get().GetTimeStamp(*PackageFilePath)));
+}
+
+uint32 UHoudiniInputHolder::GetComponentsContentHash(const TArray<const UActorComponent*>& Components, const TArray<FTransform>& Transforms)
+{
+	uint32 Hash = GetTypeHash(Components.Num());
+	FArchiveObjectCrc32 ObjectCrc;
+	for (int32 CompIdx = 0; CompIdx < Components.Num(); ++CompIdx)
+	{
+		const UActorComponent* Component = Components[CompIdx];
+		Hash = HashCombine(Hash, GetTypeHash(Component->GetClass()->GetName()));
+		Hash = HashCombine(Hash, GetTransformHash(Transforms[CompIdx]));
+		Hash = HashCombine(Hash, ObjectCrc.Crc32(const_cast<UActorComponent*>(Component)));  // Such as spline points, instances and override materials
+
+		// Referenced assets could be modified without touching the component, so we should also identify them
+		for (FPropertyValueIterator PropIter(FObjectPropertyBase::StaticClass(), Component->GetClass(), Component); PropIter; ++PropIter)
+		{
+			const UObject* RefObject = CastFieldChecked<FObjectPropertyBase>(PropIter.Key())->GetObjectPropertyValue(PropIter.Value());
+			if (!IsValid(RefObject) || !RefObject->IsAsset())
+				continue;
+
+			const uint32 AssetHash = GetAssetContentHash(FSoftObjectPath(RefObject));
+			if (AssetHash == 0)
+				return 0;
+
+			Hash = HashCombine(Hash, AssetHash);
+		}
+	}
+
+	return Hash;
+}
+
+uint32 UHoudiniInputHolder::GetContentHash() const
+{
+	const uint32 Hash = GetTypeHash(GetClass()->GetName());
+	const TSoftObjectPtr<UObject> Object = GetObject();
+	if (Object.IsNull())  // Such as curves and masks, their modifications will reset node's cook key
+		return Hash;
+
+	// Assets, should identify by the saved package file, actors and landscapes override this
+	const uint32 AssetHash = GetAssetContentHash(Object.ToSoftObjectPath());
+	return (AssetHash == 0) ? 0 : HashCombine(Hash, AssetHash);
+}
+
 // -------- InputCurves --------
 UHoudiniInputCurves* UHoudiniInputCurves::Create(UHoudiniInput* Input)
 {
@@ -125,6 +196,12 @@ TSoftObjectPtr<UObject> UHoudiniInputNode::GetObject() const
 	return GetNode();
 }
 
+uint32 UHoudiniInputNode::GetContentHash() const
+{
+	const AHoudiniNode* UpstreamNode = GetNode();
+	return IsValid(UpstreamNode) ? UpstreamNode->GetLastCookKey() : 0;
+}
+
 AHoudiniNode* UHoudiniInputNode::GetNode() const
 {
 	if (Node.IsValid())
@@ -259,17 +336,11 @@ AActor* UHoudiniInputActor::GetActor() const
 	return Actor.IsValid() ? Actor.Get() : nullptr;
 }
 
-bool UHoudiniInputActor::HapiUpload()
+void UHoudiniInputActor::GetComponents(const AActor* A, TArray<const UActorComponent*>& OutComponents, TArray<FTransform>& OutTransforms) const
 {
-	const AActor* A = GetActor();
-	if (!IsValid(A))
-		HapiDestroy();
-
 	TArray<const UClass*> AllowClasses, DisallowClasses;
 	GetSettings().GetFilterClasses(AllowClasses, DisallowClasses, UActorComponent::StaticClass());
 
-	TArray<const UActorComponent*> Components;
-	TArray<FTransform> Transforms;
 	if (const ALevelInstance* LevelInstance = Cast<ALevelInstance>(A))
 	{
 		const UWorld* LevelInstanceWorld = LevelInstance->GetWorldAsset().LoadSynchronous();
@@ -286,11 +357,11 @@ bool UHoudiniInputActor::HapiUpload()
 				{
 					if (IsValid(Component) && FHoudiniEngineUtils::FilterClass(AllowClasses, DisallowClasses, Component->GetClass()))
 					{
-						Components.Add(Component);
+						OutComponents.Add(Component);
 						if (const USceneComponent* SC = Cast<USceneComponent>(Component))
-							Transforms.Add(SC->GetComponentTransform() * ActorTransform);
+							OutTransforms.Add(SC->GetComponentTransform() * ActorTransform);
 						else
-							Transforms.Add(LevelActor->GetActorTransform() * ActorTransform);
+							OutTransforms.Add(LevelActor->GetActorTransform() * ActorTransform);
 					}
 				}
 			}
@@ -302,14 +373,25 @@ bool UHoudiniInputActor::HapiUpload()
 		{
 			if (IsValid(Component) && FHoudiniEngineUtils::FilterClass(AllowClasses, DisallowClasses, Component->GetClass()))
 			{
-				Components.Add(Component);
+				OutComponents.Add(Component);
 				if (const USceneComponent* SC = Cast<USceneComponent>(Component))
-					Transforms.Add(SC->GetComponentTransform());
+					OutTransforms.Add(SC->GetComponentTransform());
 				else
-					Transforms.Add(A->GetActorTransform());
+					OutTransforms.Add(A->GetActorTransform());
 			}
 		}
 	}
+}
+
+bool UHoudiniInputActor::HapiUpload()
+{
+	const AActor* A = GetActor();
+	if (!IsValid(A))
+		HapiDestroy();
+
+	TArray<const UActorComponent*> Components;
+	TArray<FTransform> Transforms;
+	GetComponents(A, Components, Transforms);
 
 	HOUDINI_FAIL_RETURN(UHoudiniInputComponents::HapiUploadComponents(A, Components, Transforms));
 
@@ -318,6 +400,21 @@ bool UHoudiniInputActor::HapiUpload()
 	return true;
 }
 
+uint32 UHoudiniInputActor::GetContentHash() const
+{
+	const uint32 Hash = GetTypeHash(GetClass()->GetName());
+	const AActor* A = GetActor();
+	if (!IsValid(A))  // Actor NOT loaded, so nothing will be uploaded
+		return Hash;
+
+	TArray<const UActorComponent*> Components;
+	TArray<FTransform> Transforms;
+	GetComponents(A, Components, Transforms);
+
+	const uint32 ComponentsHash = GetComponentsContentHash(Components, Transforms);
+	return (ComponentsHash == 0) ? 0 : HashCombine(HashCombine(Hash, GetTypeHash(ActorName.ToString())), ComponentsHash);
+}
+
 // -------- InputDataTable --------
 UHoudiniInputHolder* FHoudiniDataTableInputBuilder::CreateOrUpdate(UHoudiniInput* Input, UObject* Asset, UHoudiniInputHolder* OldHolder)
 {
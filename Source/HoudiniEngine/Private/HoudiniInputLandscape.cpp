@@ -2,11 +2,14 @@
 
 #include "HoudiniInputs.h"
 
+#include "Tasks/Task.h"
 #include "Landscape.h"
 #include "LandscapeLayerInfoObject.h"
 #include "LandscapeEdit.h"
 #include "LandscapeSplineControlPoint.h"
 #include "LandscapeSplinesComponent.h"
+#include "LandscapeComponent.h"
+#include "Serialization/ArchiveObjectCrc32.h"
 #if ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 6)) || (ENGINE_MAJOR_VERSION > 5)
 #include "LandscapeEditLayer.h"
 #endif
@@ -17,6 +20,40 @@
 #include "HoudiniOperatorUtils.h"
 
 
+struct FHoudiniLayerUploadTask
+{
+	FHoudiniLayerUploadTask(const FName& InEditLayerName, const FName& InLayerName, ULandscapeLayerInfoObject* InLayerInfo, const FIntRect& LandscapeExtent) :
+		EditLayerName(InEditLayerName), LayerName(InLayerName), LayerInfo(InLayerInfo),
+		SHMVolumeInput(InLayerInfo ? EHoudiniVolumeConvertDataType::Uint8 : EHoudiniVolumeConvertDataType::Uint16,
+			EHoudiniVolumeStorageType::Float, FIntVector3(LandscapeExtent.Height() + 1, LandscapeExtent.Width() + 1, 1))  // X and Y is swaped in houdini
+	{
+#if ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 7)) || (ENGINE_MAJOR_VERSION > 5)
+		VolumeName = LayerInfo ? ((LayerInfo == ALandscapeProxy::VisibilityLayer) ? TEXT("Alpha") : LayerInfo->GetLayerName().ToString()) : TEXT("height");
+#else
+		VolumeName = LayerInfo ? ((LayerInfo == ALandscapeProxy::VisibilityLayer) ? TEXT("Alpha") : LayerInfo->LayerName.ToString()) : TEXT("height");
+#endif
+	}
+
+	FName EditLayerName;
+
+	FName LayerName;  // Key of FHoudiniEditLayerImportInfo::LayerImportInfoMap
+
+	ULandscapeLayerInfoObject* LayerInfo = nullptr;  // nullptr means we should import height
+
+	FString VolumeName;
+
+	const ALandscape* Landscape = nullptr;
+
+	FHoudiniSharedMemoryVolumeInput SHMVolumeInput;
+
+	float* SHM = nullptr;
+
+	bool bPartialUpdate = false;
+
+	UE::Tasks::FTask PackTask;
+};
+
+
 ALandscape* UHoudiniInputLandscape::TryCast(AActor* InLandscape)
 {
 	ALandscape* Landscape = Cast<ALandscape>(InLandscape);
@@ -67,6 +104,55 @@ TSoftObjectPtr<UObject> UHoudiniInputLandscape::GetObject() const
 	return GetLandscape();
 }
 
+uint32 UHoudiniInputLandscape::GetContentHash() const
+{
+	uint32 Hash = GetTypeHash(GetClass()->GetName());
+	ALandscape* LandscapeActor = GetLandscape();
+	ULandscapeInfo* LandscapeInfo = IsValid(LandscapeActor) ? LandscapeActor->GetLandscapeInfo() : nullptr;
+	if (!IsValid(LandscapeInfo))  // Landscape NOT loaded, so nothing will be uploaded
+		return Hash;
+
+	Hash = HashCombine(Hash, GetTypeHash(LandscapeName.ToString()));
+	Hash = HashCombine(Hash, GetTransformHash(LandscapeActor->GetActorTransform()));
+
+	FIntRect LandscapeExtent;
+	LandscapeInfo->GetLandscapeExtent(LandscapeExtent);
+	Hash = HashCombine(Hash, FCrc::MemCrc32(&LandscapeExtent, sizeof(FIntRect)));
+
+	// Layers are uploaded from edit layers, and any modification on them will be merged into heightmaps and weightmaps, whose source id will change
+	TArray<FIntPoint> ComponentKeys;
+	LandscapeInfo->XYtoComponentMap.GetKeys(ComponentKeys);
+	ComponentKeys.Sort([](const FIntPoint& A, const FIntPoint& B) { return (A.Y < B.Y) || ((A.Y == B.Y) && (A.X < B.X)); });
+	for (const FIntPoint& ComponentKey : ComponentKeys)
+	{
+		const ULandscapeComponent* LandscapeComponent = LandscapeInfo->XYtoComponentMap[ComponentKey];
+		if (!IsValid(LandscapeComponent))
+			continue;
+
+		if (const UTexture2D* Heightmap = LandscapeComponent->GetHeightmap())
+			Hash = HashCombine(Hash, GetTypeHash(Heightmap->Source.GetId()));
+
+		for (const UTexture2D* Weightmap : LandscapeComponent->GetWeightmapTextures())
+		{
+			if (IsValid(Weightmap))
+				Hash = HashCombine(Hash, GetTypeHash(Weightmap->Source.GetId()));
+		}
+	}
+
+	if (GetSettings().bImportLandscapeSplines)
+	{
+		FArchiveObjectCrc32 ObjectCrc;
+		LandscapeInfo->ForAllSplineActors([&](TScriptInterface<ILandscapeSplineInterface> SplineInterface)
+			{
+				ULandscapeSplinesComponent* LSC = SplineInterface->GetSplinesComponent();
+				if (IsValid(LSC))
+					Hash = HashCombine(Hash, ObjectCrc.Crc32(LSC));
+			});
+	}
+
+	return Hash;
+}
+
 bool UHoudiniInputLandscape::HasLayerImported(const FName& EditLayerName, const FName& LayerName) const
 {
 	const FHoudiniEditLayerImportInfo* FoundEditLayerImportInfoPtr = EditLayerName.IsNone() ? nullptr : EditLayerImportInfoMap.Find(EditLayerName);
@@ -292,6 +378,16 @@ bool UHoudiniInputLandscape::HapiUpload()
 
 	bool bEditlayersNeedReconnect = false;
 	TMap<FName, FHoudiniEditLayerImportInfo> NewEditLayerImportInfoMap;  // If Empty, then means we should import as ref
+	TArray<FHoudiniLayerUploadTask> LayerUploadTasks;  // Layers are fetched in order, packed concurrently, then uploaded in order
+	TArray<FName> EditLayersNeedReconnect;  // Means we need to reconnect layer import nodes to "merge" node of these editlayers
+	auto WaitPackTasksAndUnmapLambda = [&LayerUploadTasks]()  // Must be called before return when failed, as launched pack tasks are still writing the shm
+		{
+			for (FHoudiniLayerUploadTask& LayerUploadTask : LayerUploadTasks)
+			{
+				LayerUploadTask.PackTask.Wait();
+				FHoudiniEngineUtils::UnmapSharedMemory(LayerUploadTask.SHM);
+			}
+		};
 
 	if (!GetSettings().bImportAsReference)
 	{
@@ -389,9 +485,12 @@ bool UHoudiniInputLandscape::HapiUpload()
 				
 				if (NewEditLayerImportInfo.MergeNodeId < 0)
 				{
-					HAPI_SESSION_FAIL_RETURN(FHoudiniApi::CreateNode(FHoudiniEngine::Get().GetSession(), GetGeoNodeId(), "merge",
+					const HAPI_Result Result = FHoudiniApi::CreateNode(FHoudiniEngine::Get().GetSession(), GetGeoNodeId(), "merge",
 						TCHAR_TO_UTF8(*FString::Printf(TEXT("%s_%08X"), *FHoudiniEngineUtils::GetValidatedString(EditLayerName.ToString()), FPlatformTime::Cycles())),
-						false, &NewEditLayerImportInfo.MergeNodeId));
+						false, &NewEditLayerImportInfo.MergeNodeId);
+					if (HAPI_SESSION_INVALID_RESULT(Result))
+						WaitPackTasksAndUnmapLambda();
+					HAPI_SESSION_FAIL_RETURN(Result);
 
 					bEditlayersNeedReconnect = true;  // Means we need to reconnect editlayer-import-nodes to "merge" node if UHoudiniInputLandscape
 				}
@@ -415,23 +514,44 @@ bool UHoudiniInputLandscape::HapiUpload()
 			if (NewLayerImportInfo.NodeId < 0)
 				bNewLayerImported = true;  // Means we need to reconnect layer import nodes to "merge" node of NewEditLayerImportInfo
 
-			HOUDINI_FAIL_RETURN(NewLayerImportInfo.HapiUpload(LandscapeEdit, EditLayerName, LayerInfo,
-				LandscapeTransform.GetScale3D().Z, NewLandscapeExtent, GetGeoNodeId()));
+			NewLayerImportInfo.Pack(LandscapeEdit, LayerUploadTasks.Emplace_GetRef(EditLayerName, LayerName, LayerInfo, NewLandscapeExtent),
+				NewLandscapeExtent);
 		}
 
-		// Connect to new nodes
 		if (bNewLayerImported)
+			EditLayersNeedReconnect.Add(EditLayerName);
+	}
+	}
+
+	// -------- Upload packed layers, HAPI calls must be in order --------
+	bool bLayersUploaded = true;
+	for (FHoudiniLayerUploadTask& LayerUploadTask : LayerUploadTasks)
+	{
+		if (bLayersUploaded)
 		{
-			const int32& LayerMergeNodeId = NewEditLayerImportInfo.MergeNodeId;
-			int32 MergeInputIdx = 0;
-			for (const auto& NewLayerImportInfo : NewEditLayerImportInfo.LayerImportInfoMap)
-			{
-				HAPI_SESSION_FAIL_RETURN(FHoudiniApi::ConnectNodeInput(FHoudiniEngine::Get().GetSession(),
-					LayerMergeNodeId, MergeInputIdx, NewLayerImportInfo.Value.NodeId, 0));
-				++MergeInputIdx;
-			}
+			bLayersUploaded = NewEditLayerImportInfoMap[LayerUploadTask.EditLayerName].LayerImportInfoMap[LayerUploadTask.LayerName].HapiUpload(
+				LayerUploadTask, LandscapeTransform.GetScale3D().Z, NewLandscapeExtent, GetGeoNodeId());
+		}
+		else  // Previous upload failed, just wait the pack task and unmap the shm
+		{
+			LayerUploadTask.PackTask.Wait();
+			FHoudiniEngineUtils::UnmapSharedMemory(LayerUploadTask.SHM);
 		}
 	}
+	HOUDINI_FAIL_RETURN(bLayersUploaded);
+
+	// Connect to new nodes
+	for (const FName& EditLayerName : EditLayersNeedReconnect)
+	{
+		const FHoudiniEditLayerImportInfo& NewEditLayerImportInfo = NewEditLayerImportInfoMap[EditLayerName];
+		const int32& LayerMergeNodeId = NewEditLayerImportInfo.MergeNodeId;
+		int32 MergeInputIdx = 0;
+		for (const auto& NewLayerImportInfo : NewEditLayerImportInfo.LayerImportInfoMap)
+		{
+			HAPI_SESSION_FAIL_RETURN(FHoudiniApi::ConnectNodeInput(FHoudiniEngine::Get().GetSession(),
+				LayerMergeNodeId, MergeInputIdx, NewLayerImportInfo.Value.NodeId, 0));
+			++MergeInputIdx;
+		}
 	}
 
 	// -------- Cleanup old nodes --------
@@ -521,46 +641,33 @@ FORCEINLINE static float GetLandscapeVisibilityScaleToAlpha(const ALandscape* La
 	return 1.5f;
 }
 
-bool FHoudiniLayerImportInfo::HapiUpload(FLandscapeEditDataInterface& LandscapeEdit,
-	const FName& EditLayerName, ULandscapeLayerInfoObject* LayerInfo,  // LayerInfo == nullptr, means we should import height
-	const float& ZScale, const FIntRect& LandscapeExtent,
-	const int32& GeoNodeId)
+void FHoudiniLayerImportInfo::Pack(FLandscapeEditDataInterface& LandscapeEdit, FHoudiniLayerUploadTask& Task,
+	const FIntRect& LandscapeExtent)
 {
-	const bool bIsAlphaLayer = (LayerInfo == ALandscapeProxy::VisibilityLayer);
-#if ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 7)) || (ENGINE_MAJOR_VERSION > 5)
-	const FString LayerName = LayerInfo ? (bIsAlphaLayer ? TEXT("Alpha") : LayerInfo->GetLayerName().ToString()) : TEXT("height");
-#else
-	const FString LayerName = LayerInfo ? (bIsAlphaLayer ? TEXT("Alpha") : LayerInfo->LayerName.ToString()) : TEXT("height");
-#endif
-	FHoudiniSharedMemoryVolumeInput SHMVolumeInput(LayerInfo ? EHoudiniVolumeConvertDataType::Uint8 : EHoudiniVolumeConvertDataType::Uint16,
-		EHoudiniVolumeStorageType::Float, FIntVector3(LandscapeExtent.Height() + 1, LandscapeExtent.Width() + 1, 1));  // X and Y is swaped in houdini
-
-	const ALandscape* Landscape = LandscapeEdit.GetTargetLandscape();
+	Task.Landscape = LandscapeEdit.GetTargetLandscape();
 
 	bool bSHMExists = false;
-	float* const SHM = SHMVolumeInput.GetSharedMemory(
-		FString::Printf(TEXT("%08X_%s_%s"), (size_t)Landscape,
-		*FHoudiniEngineUtils::GetValidatedString(EditLayerName.ToString()), *LayerName), Handle, bSHMExists);
+	Task.SHM = Task.SHMVolumeInput.GetSharedMemory(
+		FString::Printf(TEXT("%08X_%s_%s"), (size_t)Task.Landscape,
+		*FHoudiniEngineUtils::GetValidatedString(Task.EditLayerName.ToString()), *Task.VolumeName), Handle, bSHMExists);
 
-	const bool bPartialUpdate = (NodeId >= 0 && bSHMExists && ChangedExtent != INVALID_LANDSCAPE_EXTENT);  // Check whether we could upload data partially
-	const FIntRect& Extent = bPartialUpdate ? ChangedExtent : LandscapeExtent;
+	Task.bPartialUpdate = (NodeId >= 0 && bSHMExists && ChangedExtent != INVALID_LANDSCAPE_EXTENT);  // Check whether we could upload data partially
+	const FIntRect& Extent = Task.bPartialUpdate ? ChangedExtent : LandscapeExtent;
 
 	const int32 LandscapeSizeY = LandscapeExtent.Height() + 1;
 	const int32 ExtentSizeX = Extent.Width() + 1;
 	const int32 ExtentSizeY = Extent.Height() + 1;
-	const int32 XStart = Extent.Min.X - LandscapeExtent.Min.X;
-	const int32 YStart = Extent.Min.Y - LandscapeExtent.Min.Y;
+	const size_t DstOffset = size_t(Extent.Min.X - LandscapeExtent.Min.X) * LandscapeSizeY + (Extent.Min.Y - LandscapeExtent.Min.Y);
 
-	if (LayerInfo)
+	if (Task.LayerInfo)
 	{
 		TArray64<uint8> Data;
 		Data.SetNumUninitialized(ExtentSizeX * ExtentSizeY);
-		LandscapeEdit.GetWeightDataFast(LayerInfo, Extent.Min.X, Extent.Min.Y, Extent.Max.X, Extent.Max.Y, Data.GetData(), 0);
-		uint8* DataPtr = (uint8*)SHM;
-		ParallelFor(ExtentSizeY, [&](int32 nY)
+		LandscapeEdit.GetWeightDataFast(Task.LayerInfo, Extent.Min.X, Extent.Min.Y, Extent.Max.X, Extent.Max.Y, Data.GetData(), 0);
+		Task.PackTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Data = MoveTemp(Data), DataPtr = (uint8*)Task.SHM + DstOffset, LandscapeSizeY, ExtentSizeX, ExtentSizeY]
 			{
-				for (int32 nX = 0; nX < ExtentSizeX; ++nX)
-					DataPtr[(nX + XStart) * LandscapeSizeY + (nY + YStart)] = Data[nY * ExtentSizeX + nX];
+				FHoudiniEngineUtils::TransposeData(DataPtr, LandscapeSizeY, Data.GetData(), ExtentSizeX,
+					ExtentSizeX, ExtentSizeY, [](const uint8& Value) { return Value; });
 			});
 	}
 	else
@@ -568,33 +675,39 @@ bool FHoudiniLayerImportInfo::HapiUpload(FLandscapeEditDataInterface& LandscapeE
 		TArray64<uint16> Data;
 		Data.SetNumUninitialized(ExtentSizeX * ExtentSizeY);
 		LandscapeEdit.GetHeightDataFast(Extent.Min.X, Extent.Min.Y, Extent.Max.X, Extent.Max.Y, Data.GetData(), 0);
-		uint16* DataPtr = (uint16*)SHM;
-		ParallelFor(ExtentSizeY, [&](int32 nY)
+		Task.PackTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Data = MoveTemp(Data), DataPtr = (uint16*)Task.SHM + DstOffset, LandscapeSizeY, ExtentSizeX, ExtentSizeY]
 			{
-				for (int32 nX = 0; nX < ExtentSizeX; ++nX)
-					DataPtr[(nX + XStart) * LandscapeSizeY + (nY + YStart)] = Data[nY * ExtentSizeX + nX];
+				FHoudiniEngineUtils::TransposeData(DataPtr, LandscapeSizeY, Data.GetData(), ExtentSizeX,
+					ExtentSizeX, ExtentSizeY, [](const uint16& Value) { return Value; });
 			});
 	}
-	
+}
+
+bool FHoudiniLayerImportInfo::HapiUpload(FHoudiniLayerUploadTask& Task,
+	const float& ZScale, const FIntRect& LandscapeExtent,
+	const int32& GeoNodeId)
+{
+	Task.PackTask.Wait();
 
 	if (NodeId < 0)
 	{
 		HOUDINI_FAIL_RETURN(FHoudiniSharedMemoryVolumeInput::HapiCreateNode(GeoNodeId,
-			FString::Printf(TEXT("%s_%08X"), *LayerName, FPlatformTime::Cycles()), NodeId));
+			FString::Printf(TEXT("%s_%08X"), *Task.VolumeName, FPlatformTime::Cycles()), NodeId));
 	}
 
-	if (bPartialUpdate)
+	if (Task.bPartialUpdate)
 	{
-		HOUDINI_FAIL_RETURN(SHMVolumeInput.HapiPartialUpload(NodeId, SHM, true,
+		HOUDINI_FAIL_RETURN(Task.SHMVolumeInput.HapiPartialUpload(NodeId, Task.SHM, true,
 			FIntVector3(ChangedExtent.Min.Y, ChangedExtent.Min.X, 0), FIntVector3(ChangedExtent.Max.Y, ChangedExtent.Max.X, 0)));  // X and Y is swaped in houdini
 	}
 	else
 	{
-		SHMVolumeInput.AppendAttribute(HAPI_ATTRIB_UNREAL_LANDSCAPE_EDITLAYER_NAME,
-			EHoudiniAttributeOwner::Prim, false, EditLayerName.ToString());
-		HOUDINI_FAIL_RETURN(SHMVolumeInput.HapiUpload(NodeId, SHM, LayerInfo ?
-				(bIsAlphaLayer ? FVector2f(GetLandscapeVisibilityScaleToAlpha(Landscape), 0.0f) : FVector2f(0.0f, 1.0f)) : FVector2f(-256.0f, 256.0f) * ZScale * POSITION_SCALE_TO_HOUDINI_F,
-			LayerName, false, FIntVector3::ZeroValue, FIntVector3::ZeroValue, false));
+		const bool bIsAlphaLayer = (Task.LayerInfo == ALandscapeProxy::VisibilityLayer);
+		Task.SHMVolumeInput.AppendAttribute(HAPI_ATTRIB_UNREAL_LANDSCAPE_EDITLAYER_NAME,
+			EHoudiniAttributeOwner::Prim, false, Task.EditLayerName.ToString());
+		HOUDINI_FAIL_RETURN(Task.SHMVolumeInput.HapiUpload(NodeId, Task.SHM, Task.LayerInfo ?
+				(bIsAlphaLayer ? FVector2f(GetLandscapeVisibilityScaleToAlpha(Task.Landscape), 0.0f) : FVector2f(0.0f, 1.0f)) : FVector2f(-256.0f, 256.0f) * ZScale * POSITION_SCALE_TO_HOUDINI_F,
+			Task.VolumeName, false, FIntVector3::ZeroValue, FIntVector3::ZeroValue, false));
 	}
 
 	ChangedExtent = INVALID_LANDSCAPE_EXTENT;
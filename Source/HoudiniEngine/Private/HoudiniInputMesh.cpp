@@ -77,8 +77,29 @@ void AppendSimpleCollisionsToJsonStr(const FKAggregateGeom& SimpleCollisions, TA
 		*(CurrVector3fDataPtr + 2) = VECTOR.Y; \
 	}
 
+#define HOUDINI_SHM_PACK_CHUNK_SIZE 4096
+
+// Swap Y/Z and scale, store 4 floats at a time, so the last vector must be scalar to avoid overwriting the data out of range
+static void ConvertVectorsToHoudini(float* OutData, const FVector3f* Vectors, const int32& Num, const float& Scale)
+{
+	const VectorRegister4Float ScaleRegister = VectorSetFloat1(Scale);
+	const int32 NumSIMD = Num - 1;
+	for (int32 Idx = 0; Idx < NumSIMD; ++Idx)
+		VectorStore(VectorMultiply(VectorSwizzle(VectorLoadFloat3((const float*)(Vectors + Idx)), 0, 2, 1, 3), ScaleRegister), OutData + Idx * 3);
+
+	if (Num >= 1)
+	{
+		const FVector3f& Vector = Vectors[Num - 1];
+		float* LastDataPtr = OutData + (Num - 1) * 3;
+		*LastDataPtr = Vector.X * Scale;
+		*(LastDataPtr + 1) = Vector.Z * Scale;
+		*(LastDataPtr + 2) = Vector.Y * Scale;
+	}
+}
+
 bool UHoudiniInputStaticMesh::HapiImportMeshDescription(const UStaticMesh* SM, const UStaticMeshComponent* SMC,
-	const FHoudiniInputSettings& Settings, const int32& GeoNodeId, int32& InOutSHMInputNodeId, size_t& InOutHandle)
+	const FHoudiniInputSettings& Settings, const int32& GeoNodeId, int32& InOutSHMInputNodeId, size_t& InOutHandle,
+	const FString& SHMIdentifier, TSharedPtr<FHoudiniSharedMemoryGeometryInput>& OutSHMGeoInput)
 {
 	TArray<TPair<int32, const FMeshDescription*>> IdxMeshDescs;
 	if (Settings.CollisionImportMethod != EHoudiniMeshCollisionImportMethod::NoImportCollision && IsValid(SM->ComplexCollisionMesh))
@@ -139,6 +160,9 @@ bool UHoudiniInputStaticMesh::HapiImportMeshDescription(const UStaticMesh* SM, c
 	size_t NumPoints = 0;
 	size_t NumTriangles = 0;
 	int32 NumUVChannels = 0;
+	bool bUniformColor = true;  // Vertex colors are usually all white, then we could upload them as an unique value
+	bool bHasColor = false;
+	FVector4f UniformColor = FVector4f::One();
 
 	TArray<int32> ImportMaterialIndices;
 	for (const TPair<int32, const FMeshDescription*>& IdxMeshDesc : IdxMeshDescs)
@@ -146,6 +170,23 @@ bool UHoudiniInputStaticMesh::HapiImportMeshDescription(const UStaticMesh* SM, c
 		const int32& LodIdx = IdxMeshDesc.Key;
 		const FMeshDescription* MeshDesc = IdxMeshDesc.Value;
 
+		if (bUniformColor)
+		{
+			for (const FVector4f& Color : FStaticMeshConstAttributes(*MeshDesc).GetVertexInstanceColors().GetRawArray())
+			{
+				if (!bHasColor)
+				{
+					UniformColor = Color;
+					bHasColor = true;
+				}
+				else if (Color != UniformColor)
+				{
+					bUniformColor = false;
+					break;
+				}
+			}
+		}
+
 		NumPoints += MeshDesc->Vertices().Num();  // accumulate @numpt
 		NumTriangles += MeshDesc->Triangles().Num();  // accumulate @numprim
 		NumUVChannels = FMath::Max(MeshDesc->GetNumUVElementChannels(), NumUVChannels);
@@ -163,15 +204,22 @@ bool UHoudiniInputStaticMesh::HapiImportMeshDescription(const UStaticMesh* SM, c
 	const size_t NumVertices = NumTriangles * 3;  // Finally, @numvtx = @numprim * 3, as all prims are triangles.
 	const bool bShouldImportLodGroups = (NumGroupsToImport >= 2);
 
-	FHoudiniSharedMemoryGeometryInput SHMGeoInput(NumPoints, NumTriangles, NumVertices);
-	SHMGeoInput.AppendAttribute(HAPI_ATTRIB_NORMAL, EHoudiniAttributeOwner::Vertex, EHoudiniInputAttributeStorage::Float, 3, NumVertices * 3);  // v@N
-	SHMGeoInput.AppendAttribute(HAPI_ATTRIB_TANGENT, EHoudiniAttributeOwner::Vertex, EHoudiniInputAttributeStorage::Float, 3, NumVertices * 3);  // v@tangenu
-	SHMGeoInput.AppendAttribute(HAPI_ATTRIB_TANGENT2, EHoudiniAttributeOwner::Vertex, EHoudiniInputAttributeStorage::Float, 3, NumVertices * 3);  // v@tangenv
-	SHMGeoInput.AppendAttribute(HAPI_ATTRIB_COLOR, EHoudiniAttributeOwner::Vertex, EHoudiniInputAttributeStorage::Float, 3, NumVertices * 3);  // v@Cd
-	SHMGeoInput.AppendAttribute(HAPI_ALPHA, EHoudiniAttributeOwner::Vertex, EHoudiniInputAttributeStorage::Float, 1, NumVertices);  // f@Alpha
+	// Geometry and vertex attributes below will be fully written, so need NOT zero them
+	FHoudiniSharedMemoryGeometryInput SHMGeoInput(NumPoints, NumTriangles, NumVertices, false);
+	SHMGeoInput.AppendAttribute(HAPI_ATTRIB_NORMAL, EHoudiniAttributeOwner::Vertex, EHoudiniInputAttributeStorage::Float, 3, NumVertices * 3,
+		EHoudiniInputAttributeCompression::None, false);  // v@N
+	SHMGeoInput.AppendAttribute(HAPI_ATTRIB_TANGENT, EHoudiniAttributeOwner::Vertex, EHoudiniInputAttributeStorage::Float, 3, NumVertices * 3,
+		EHoudiniInputAttributeCompression::None, false);  // v@tangenu
+	SHMGeoInput.AppendAttribute(HAPI_ATTRIB_TANGENT2, EHoudiniAttributeOwner::Vertex, EHoudiniInputAttributeStorage::Float, 3, NumVertices * 3,
+		EHoudiniInputAttributeCompression::None, false);  // v@tangenv
+	SHMGeoInput.AppendAttribute(HAPI_ATTRIB_COLOR, EHoudiniAttributeOwner::Vertex, EHoudiniInputAttributeStorage::Float, 3, bUniformColor ? 3 : NumVertices * 3,
+		bUniformColor ? EHoudiniInputAttributeCompression::UniqueValue : EHoudiniInputAttributeCompression::None, false);  // v@Cd
+	SHMGeoInput.AppendAttribute(HAPI_ALPHA, EHoudiniAttributeOwner::Vertex, EHoudiniInputAttributeStorage::Float, 1, bUniformColor ? 1 : NumVertices,
+		bUniformColor ? EHoudiniInputAttributeCompression::UniqueValue : EHoudiniInputAttributeCompression::None, false);  // f@Alpha
 	for (int32 UVChannelIdx = 1; UVChannelIdx <= NumUVChannels; ++UVChannelIdx)
 		SHMGeoInput.AppendAttribute(UVChannelIdx == 1 ? HAPI_ATTRIB_UV : TCHAR_TO_UTF8(*(TEXT(HAPI_ATTRIB_UV) + FString::FromInt(UVChannelIdx))),
-			EHoudiniAttributeOwner::Vertex, EHoudiniInputAttributeStorage::Float, 3, NumVertices * 3);  // v@uv, v@uv2, v@uv3, etc.
+			EHoudiniAttributeOwner::Vertex, EHoudiniInputAttributeStorage::Float, 3, NumVertices * 3,
+			EHoudiniInputAttributeCompression::None, false);  // v@uv, v@uv2, v@uv3, etc.
 
 	if (bShouldImportLodGroups)
 	{
@@ -215,7 +263,7 @@ bool UHoudiniInputStaticMesh::HapiImportMeshDescription(const UStaticMesh* SM, c
 			(MaterialAttribCompression == EHoudiniInputAttributeCompression::UniqueValue) ? (NumMaterialChars / 4 + 1) : (NumMaterialChars / 4 + 2 + NumTriangles), MaterialAttribCompression);
 	}
 
-	float* const SHM = SHMGeoInput.GetSharedMemory(FString::Printf(TEXT("%08X"), (size_t)SM), InOutHandle);
+	float* const SHM = SHMGeoInput.GetSharedMemory(SHMIdentifier, InOutHandle);
 
 	float* PositionDataPtr = SHM;
 	int32* VertexDataPtr = (int32*)(PositionDataPtr + NumPoints * 3);
@@ -223,8 +271,15 @@ bool UHoudiniInputStaticMesh::HapiImportMeshDescription(const UStaticMesh* SM, c
 	float* TangentUDataPtr = NormalDataPtr + NumVertices * 3;
 	float* TangentVDataPtr = TangentUDataPtr + NumVertices * 3;
 	float* ColorDataPtr = TangentVDataPtr + NumVertices * 3;
-	float* AlphaDataPtr = ColorDataPtr + NumVertices * 3;
-	float* UVsDataPtr = AlphaDataPtr + NumVertices;
+	float* AlphaDataPtr = ColorDataPtr + (bUniformColor ? 3 : NumVertices * 3);
+	float* UVsDataPtr = AlphaDataPtr + (bUniformColor ? 1 : NumVertices);
+	if (bUniformColor)
+	{
+		*ColorDataPtr = UniformColor.X;
+		*(ColorDataPtr + 1) = UniformColor.Y;
+		*(ColorDataPtr + 2) = UniformColor.Z;
+		*AlphaDataPtr = UniformColor.W;
+	}
 	int32* GroupDataPtr = (int32*)(UVsDataPtr + NumVertices * NumUVChannels * 3);
 	char* MaterialDataPtr = (char*)(bShouldImportLodGroups ?
 		(GroupDataPtr + NumGroupsToImport * NumTriangles) : (int32*)(UVsDataPtr + NumVertices * NumUVChannels * 3));
@@ -249,17 +304,11 @@ bool UHoudiniInputStaticMesh::HapiImportMeshDescription(const UStaticMesh* SM, c
 		const int32& LodIdx = IdxMeshDescs[GroupIdx].Key;
 		const FMeshDescription* MeshDesc = IdxMeshDescs[GroupIdx].Value;
 
-		for (const FVertexID& VtxID : MeshDesc->Vertices().GetElementIDs())
-		{
-			const FVector3f Position = MeshDesc->GetVertexPosition(VtxID) * POSITION_SCALE_TO_HOUDINI_F;
-			*PositionDataPtr = Position.X;
-			*(PositionDataPtr + 1) = Position.Z;
-			*(PositionDataPtr + 2) = Position.Y;
-			PositionDataPtr += 3;
-		}
+		const int32 NumCurrPoints = MeshDesc->Vertices().Num();
+		const int32 NumCurrTriangles = MeshDesc->Triangles().Num();
 
 		FStaticMeshConstAttributes Attributes(*MeshDesc);
-		//TVertexAttributesConstRef<FVector3f> VertexPositions = Attributes.GetVertexPositions();
+		const TArrayView<const FVector3f> VertexPositions = Attributes.GetVertexPositions().GetRawArray();
 		TVertexInstanceAttributesConstRef<FVector3f> VertexInstanceNormals = Attributes.GetVertexInstanceNormals();
 		TVertexInstanceAttributesConstRef<FVector3f> VertexInstanceTangents = Attributes.GetVertexInstanceTangents();
 		TVertexInstanceAttributesConstRef<float> VertexInstanceBinormalSigns = Attributes.GetVertexInstanceBinormalSigns();
@@ -267,63 +316,114 @@ bool UHoudiniInputStaticMesh::HapiImportMeshDescription(const UStaticMesh* SM, c
 		TVertexInstanceAttributesConstRef<FVector2f> VertexInstanceUVs = Attributes.GetVertexInstanceUVs();
 		//TEdgeAttributesConstRef<bool> EdgeHardnesses = Attributes.GetEdgeHardnesses();
 
-		int32* CurrLodDataPtr = bShouldImportLodGroups ? (GroupDataPtr + GroupIdx * NumTriangles + NumPrevTriangles) : nullptr;
-		TArray<FVertexInstanceID> VtxInstIDs;  // This is houdini vertex order
-		VtxInstIDs.Reserve(MeshDesc->Triangles().Num());
-		for (const FTriangleID& TriID : MeshDesc->Triangles().GetElementIDs())
+		// Element IDs may have holes if MeshDesc has NOT been compacted, so snapshot them and remap to contiguous houdini point and prim numbers
+		const bool bCompactVertices = (MeshDesc->Vertices().GetArraySize() == NumCurrPoints);
+		TArray<FVertexID> VertexIDs;
+		TArray<int32> VertexPointIndices;  // Indexed by FVertexID, only used when vertices are NOT compact
+		if (!bCompactVertices)
 		{
-			const TArrayView<const FVertexID> TriVtcs = MeshDesc->GetTriangleVertices(TriID);
-			*VertexDataPtr = NumPrevPoints + TriVtcs[2].GetValue();
-			*(VertexDataPtr + 1) = NumPrevPoints + TriVtcs[1].GetValue();
-			*(VertexDataPtr + 2) = NumPrevPoints + TriVtcs[0].GetValue();
-			*(VertexDataPtr + 3) = HOUDINI_SHM_GEO_INPUT_POLY;
-			VertexDataPtr += 4;
+			VertexIDs.Reserve(NumCurrPoints);
+			VertexPointIndices.Init(INDEX_NONE, MeshDesc->Vertices().GetArraySize());
+			for (const FVertexID VtxID : MeshDesc->Vertices().GetElementIDs())
+				VertexPointIndices[VtxID.GetValue()] = VertexIDs.Add(VtxID);
+		}
+		const auto GetPointIdx = [&](const FVertexID& VtxID) { return bCompactVertices ? VtxID.GetValue() : VertexPointIndices[VtxID.GetValue()]; };
 
-			const TArrayView<const FVertexInstanceID> TriVtxInsts = MeshDesc->GetTriangleVertexInstances(TriID);
-			VtxInstIDs.Add(TriVtxInsts[2]);
-			VtxInstIDs.Add(TriVtxInsts[1]);
-			VtxInstIDs.Add(TriVtxInsts[0]);
+		TArray<FTriangleID> TriIDs;  // Houdini prim order
+		TriIDs.Reserve(NumCurrTriangles);
+		TArray<int32> TriPrimIndices;  // Indexed by FTriangleID
+		TriPrimIndices.Init(INDEX_NONE, MeshDesc->Triangles().GetArraySize());
+		for (const FTriangleID TriID : MeshDesc->Triangles().GetElementIDs())
+			TriPrimIndices[TriID.GetValue()] = TriIDs.Add(TriID);
 
-			if (CurrLodDataPtr)
+		// Positions
+		ParallelFor(FMath::DivideAndRoundUp(NumCurrPoints, HOUDINI_SHM_PACK_CHUNK_SIZE), [&](int32 ChunkIdx)
+		{
+			const int32 StartIdx = ChunkIdx * HOUDINI_SHM_PACK_CHUNK_SIZE;
+			const int32 NumChunkPoints = FMath::Min(HOUDINI_SHM_PACK_CHUNK_SIZE, NumCurrPoints - StartIdx);
+			if (bCompactVertices)
 			{
-				*CurrLodDataPtr = 1;
-				++CurrLodDataPtr;
+				ConvertVectorsToHoudini(PositionDataPtr + (NumPrevPoints + StartIdx) * 3, VertexPositions.GetData() + StartIdx,
+					NumChunkPoints, POSITION_SCALE_TO_HOUDINI_F);
+				return;
 			}
-		}
 
-		const int32 NumCurrUVChannels = MeshDesc->GetNumUVElementChannels();
+			for (int32 PointIdx = StartIdx; PointIdx < StartIdx + NumChunkPoints; ++PointIdx)
+			{
+				const FVector3f& Position = VertexPositions[VertexIDs[PointIdx].GetValue()];
+				float* CurrPositionDataPtr = PositionDataPtr + (NumPrevPoints + PointIdx) * 3;
+				*CurrPositionDataPtr = Position.X * POSITION_SCALE_TO_HOUDINI_F;
+				*(CurrPositionDataPtr + 1) = Position.Z * POSITION_SCALE_TO_HOUDINI_F;
+				*(CurrPositionDataPtr + 2) = Position.Y * POSITION_SCALE_TO_HOUDINI_F;
+			}
+		});
 
-		for (int32 VtxIdx = 0; VtxIdx < VtxInstIDs.Num(); ++VtxIdx)
+		// Topology, all triangles' offset is known, so we could also fill the vertex instances in houdini vertex order
+		int32* CurrVertexDataPtr = VertexDataPtr + NumPrevTriangles * 4;
+		int32* CurrLodDataPtr = bShouldImportLodGroups ? (GroupDataPtr + GroupIdx * NumTriangles + NumPrevTriangles) : nullptr;
+		TArray<FVertexInstanceID> VtxInstIDs;  // This is houdini vertex order
+		VtxInstIDs.SetNumUninitialized(NumCurrTriangles * 3);
+		ParallelFor(FMath::DivideAndRoundUp(NumCurrTriangles, HOUDINI_SHM_PACK_CHUNK_SIZE), [&](int32 ChunkIdx)
 		{
-			const FVertexInstanceID& VtxInstID = VtxInstIDs[VtxIdx];
+			const int32 EndIdx = FMath::Min((ChunkIdx + 1) * HOUDINI_SHM_PACK_CHUNK_SIZE, NumCurrTriangles);
+			for (int32 TriIdx = ChunkIdx * HOUDINI_SHM_PACK_CHUNK_SIZE; TriIdx < EndIdx; ++TriIdx)
+			{
+				const FTriangleID& TriID = TriIDs[TriIdx];
+				const TArrayView<const FVertexID> TriVtcs = MeshDesc->GetTriangleVertices(TriID);
+				int32* TriDataPtr = CurrVertexDataPtr + TriIdx * 4;
+				*TriDataPtr = NumPrevPoints + GetPointIdx(TriVtcs[2]);
+				*(TriDataPtr + 1) = NumPrevPoints + GetPointIdx(TriVtcs[1]);
+				*(TriDataPtr + 2) = NumPrevPoints + GetPointIdx(TriVtcs[0]);
+				*(TriDataPtr + 3) = HOUDINI_SHM_GEO_INPUT_POLY;
+
+				const TArrayView<const FVertexInstanceID> TriVtxInsts = MeshDesc->GetTriangleVertexInstances(TriID);
+				VtxInstIDs[TriIdx * 3] = TriVtxInsts[2];
+				VtxInstIDs[TriIdx * 3 + 1] = TriVtxInsts[1];
+				VtxInstIDs[TriIdx * 3 + 2] = TriVtxInsts[0];
+
+				if (CurrLodDataPtr)
+					CurrLodDataPtr[TriIdx] = 1;
+			}
+		});
 
-			const FVector3f Normal = VertexInstanceNormals[VtxInstID];
-			COPY_VERTEX_VECTOR3f_DATA(NormalDataPtr, Normal);
+		// Vertex attributes, each stream has its own region, so chunks could be written concurrently
+		const int32 NumCurrUVChannels = MeshDesc->GetNumUVElementChannels();
+		ParallelFor(FMath::DivideAndRoundUp(VtxInstIDs.Num(), HOUDINI_SHM_PACK_CHUNK_SIZE), [&](int32 ChunkIdx)
+		{
+			const int32 EndIdx = FMath::Min((ChunkIdx + 1) * HOUDINI_SHM_PACK_CHUNK_SIZE, VtxInstIDs.Num());
+			for (int32 VtxIdx = ChunkIdx * HOUDINI_SHM_PACK_CHUNK_SIZE; VtxIdx < EndIdx; ++VtxIdx)
+			{
+				const FVertexInstanceID& VtxInstID = VtxInstIDs[VtxIdx];
 
-			const FVector3f Tangent = VertexInstanceTangents[VtxInstID];
-			COPY_VERTEX_VECTOR3f_DATA(TangentUDataPtr, Tangent);
+				const FVector3f Normal = VertexInstanceNormals[VtxInstID];
+				COPY_VERTEX_VECTOR3f_DATA(NormalDataPtr, Normal);
 
-			const FVector3f Binormal = (FVector3f::CrossProduct(Normal, Tangent).GetSafeNormal() * VertexInstanceBinormalSigns[VtxInstID]);
-			COPY_VERTEX_VECTOR3f_DATA(TangentVDataPtr, Binormal);
+				const FVector3f Tangent = VertexInstanceTangents[VtxInstID];
+				COPY_VERTEX_VECTOR3f_DATA(TangentUDataPtr, Tangent);
 
-			const FVector4f VertexColor = VertexInstanceColors[VtxInstID];
-			float* CurrColorDataPtr = ColorDataPtr + (NumPrevVertices + VtxIdx) * 3;
-			*CurrColorDataPtr = VertexColor.X;
-			*(CurrColorDataPtr + 1) = VertexColor.Y;
-			*(CurrColorDataPtr + 2) = VertexColor.Z;
-			*(AlphaDataPtr + NumPrevVertices + VtxIdx) = VertexColor.W;
+				const FVector3f Binormal = (FVector3f::CrossProduct(Normal, Tangent).GetSafeNormal() * VertexInstanceBinormalSigns[VtxInstID]);
+				COPY_VERTEX_VECTOR3f_DATA(TangentVDataPtr, Binormal);
 
-			for (int32 UVChannelIdx = 0; UVChannelIdx < NumUVChannels; ++UVChannelIdx)
-			{
-				if (UVChannelIdx < NumCurrUVChannels)
+				if (!bUniformColor)
 				{
-					const FVector2f UV = VertexInstanceUVs.Get(VtxInstID, UVChannelIdx);
+					const FVector4f VertexColor = VertexInstanceColors[VtxInstID];
+					float* CurrColorDataPtr = ColorDataPtr + (NumPrevVertices + VtxIdx) * 3;
+					*CurrColorDataPtr = VertexColor.X;
+					*(CurrColorDataPtr + 1) = VertexColor.Y;
+					*(CurrColorDataPtr + 2) = VertexColor.Z;
+					*(AlphaDataPtr + NumPrevVertices + VtxIdx) = VertexColor.W;
+				}
+
+				for (int32 UVChannelIdx = 0; UVChannelIdx < NumUVChannels; ++UVChannelIdx)
+				{
+					const FVector2f UV = (UVChannelIdx < NumCurrUVChannels) ? VertexInstanceUVs.Get(VtxInstID, UVChannelIdx) : FVector2f(0.0f, 1.0f);
 					float* CurrUVsDataPtr = UVsDataPtr + (UVChannelIdx * NumVertices + NumPrevVertices + VtxIdx) * 3;
 					*CurrUVsDataPtr = UV.X;
 					*(CurrUVsDataPtr + 1) = 1.0f - UV.Y;
+					*(CurrUVsDataPtr + 2) = 0.0f;
 				}
 			}
-		}
+		});
 
 		if (MaterialAttribCompression == EHoudiniInputAttributeCompression::Indexing)
 		{
@@ -335,7 +435,7 @@ bool UHoudiniInputStaticMesh::HapiImportMeshDescription(const UStaticMesh* SM, c
 					if (const int32* FoundImportIdxPtr = ImportMatIdxMap.Find(SM->GetSectionInfoMap().Get(LodIdx, PolygonGroupID.GetValue()).MaterialIndex))
 						ImportIdx = *FoundImportIdxPtr;
 					for (const FTriangleID& TriID : MeshDesc->GetPolygonGroupTriangles(PolygonGroupID))
-						MaterialIndicesDataPtr[NumPrevTriangles + TriID] = ImportIdx;
+						MaterialIndicesDataPtr[NumPrevTriangles + TriPrimIndices[TriID.GetValue()]] = ImportIdx;
 				}
 			}
 			else  // Need not import material for collision geo, so all material refs is empty (-1)
@@ -345,20 +445,36 @@ bool UHoudiniInputStaticMesh::HapiImportMeshDescription(const UStaticMesh* SM, c
 			}
 		}
 
-		NumPrevPoints += MeshDesc->Vertices().Num();
-		NumPrevVertices += MeshDesc->VertexInstances().Num();
-		NumPrevTriangles += MeshDesc->Triangles().Num();
+		NumPrevPoints += NumCurrPoints;
+		NumPrevVertices += VtxInstIDs.Num();
+		NumPrevTriangles += NumCurrTriangles;
 	}
 
 	if (InOutSHMInputNodeId < 0)
 		HOUDINI_FAIL_RETURN(FHoudiniSharedMemoryGeometryInput::HapiCreateNode(GeoNodeId,
 			FString::Printf(TEXT("mesh_%s_%08X"), *SM->GetName(), FPlatformTime::Cycles()), InOutSHMInputNodeId));
 
+	OutSHMGeoInput = MakeShared<FHoudiniSharedMemoryGeometryInput>(SHMGeoInput);  // Keep the layout, so that we could re-upload without packing again
+
 	return SHMGeoInput.HapiUpload(InOutSHMInputNodeId, SHM);
 }
 
+static const FColorVertexBuffer* GetImportColorVertexBuffer(const UStaticMeshComponent* SMC, const int32& LodIdx, const FStaticMeshLODResources& RenderMesh)
+{
+	const uint32 NumVertices = RenderMesh.VertexBuffers.StaticMeshVertexBuffer.GetNumVertices();
+	if (SMC && SMC->LODData.IsValidIndex(LodIdx))
+	{
+		const FColorVertexBuffer* OverrideColorVertexBuffer = SMC->LODData[LodIdx].OverrideVertexColors;
+		if (OverrideColorVertexBuffer && (OverrideColorVertexBuffer->GetNumVertices() == NumVertices))
+			return OverrideColorVertexBuffer;
+	}
+
+	return (RenderMesh.VertexBuffers.ColorVertexBuffer.GetNumVertices() == NumVertices) ? &RenderMesh.VertexBuffers.ColorVertexBuffer : nullptr;
+}
+
 bool UHoudiniInputStaticMesh::HapiImportRenderData(const UStaticMesh* SM, const UStaticMeshComponent* SMC,
-	const FHoudiniInputSettings& Settings, const int32& GeoNodeId, int32& InOutSHMInputNodeId, size_t& InOutHandle)
+	const FHoudiniInputSettings& Settings, const int32& GeoNodeId, int32& InOutSHMInputNodeId, size_t& InOutHandle,
+	const FString& SHMIdentifier, TSharedPtr<FHoudiniSharedMemoryGeometryInput>& OutSHMGeoInput)
 {
 	TArray<TPair<int32, const FStaticMeshLODResources*>> IdxMeshes;
 	if (Settings.CollisionImportMethod != EHoudiniMeshCollisionImportMethod::NoImportCollision && IsValid(SM->ComplexCollisionMesh))
@@ -398,6 +514,8 @@ bool UHoudiniInputStaticMesh::HapiImportRenderData(const UStaticMesh* SM, const
 	size_t NumTriangles = 0;
 	uint32 NumUVChannels = 0;
 	bool bImportVertexColor = false;
+	bool bUniformColor = true;  // Vertex colors are usually all white, then we could upload them as an unique value
+	TOptional<FColor> UniformColor;
 
 	TArray<int32> ImportMaterialIndices;
 
@@ -408,19 +526,26 @@ bool UHoudiniInputStaticMesh::HapiImportRenderData(const UStaticMesh* SM, const
 		const int32& LodIdx = IdxMesh.Key;
 		const FStaticMeshLODResources& RenderMesh = *IdxMesh.Value;
 
-		if (!bImportVertexColor)  // Judge whether we should import vertex color data
+		// Judge whether we should import vertex color data, and whether all of the colors are the same
+		const FColorVertexBuffer* ColorVertexBuffer = GetImportColorVertexBuffer(SMC, LodIdx, RenderMesh);
+		if (ColorVertexBuffer)
+			bImportVertexColor = true;
+		if (bUniformColor)
 		{
-			const FColorVertexBuffer* ColorVertexBuffer = &RenderMesh.VertexBuffers.ColorVertexBuffer;
-			if (ColorVertexBuffer->GetNumVertices() == RenderMesh.VertexBuffers.StaticMeshVertexBuffer.GetNumVertices())
-				bImportVertexColor = true;
-			else if (SMC && SMC->LODData.IsValidIndex(LodIdx))
+			const uint32 NumColors = ColorVertexBuffer ? ColorVertexBuffer->GetNumVertices() : 1;
+			for (uint32 ColorIdx = 0; ColorIdx < NumColors; ++ColorIdx)
 			{
-				ColorVertexBuffer = SMC->LODData[LodIdx].OverrideVertexColors;
-				if (ColorVertexBuffer && (ColorVertexBuffer->GetNumVertices() == RenderMesh.VertexBuffers.StaticMeshVertexBuffer.GetNumVertices()))
-					bImportVertexColor = true;
+				const FColor Color = ColorVertexBuffer ? ColorVertexBuffer->VertexColor(ColorIdx) : FColor::White;
+				if (!UniformColor.IsSet())
+					UniformColor = Color;
+				else if (Color != UniformColor.GetValue())
+				{
+					bUniformColor = false;
+					break;
+				}
 			}
 		}
-		
+
 
 		const uint32 NumOrigPoints = RenderMesh.GetNumVertices();
 		TArray<uint32> WeldPointIndices;
@@ -471,18 +596,25 @@ bool UHoudiniInputStaticMesh::HapiImportRenderData(const UStaticMesh* SM, const
 	const size_t NumVertices = NumTriangles * 3;  // Finally, @numvtx = @numprim * 3, as all prims are triangles.
 	const bool bShouldImportLodGroups = (NumGroupsToImport >= 2);
 
-	FHoudiniSharedMemoryGeometryInput SHMGeoInput(NumPoints, NumTriangles, NumVertices);
-	SHMGeoInput.AppendAttribute(HAPI_ATTRIB_NORMAL, EHoudiniAttributeOwner::Vertex, EHoudiniInputAttributeStorage::Float, 3, NumVertices * 3);  // v@N
-	SHMGeoInput.AppendAttribute(HAPI_ATTRIB_TANGENT, EHoudiniAttributeOwner::Vertex, EHoudiniInputAttributeStorage::Float, 3, NumVertices * 3);  // v@tangenu
-	SHMGeoInput.AppendAttribute(HAPI_ATTRIB_TANGENT2, EHoudiniAttributeOwner::Vertex, EHoudiniInputAttributeStorage::Float, 3, NumVertices * 3);  // v@tangenv
+	// Geometry and vertex attributes below will be fully written, so need NOT zero them
+	FHoudiniSharedMemoryGeometryInput SHMGeoInput(NumPoints, NumTriangles, NumVertices, false);
+	SHMGeoInput.AppendAttribute(HAPI_ATTRIB_NORMAL, EHoudiniAttributeOwner::Vertex, EHoudiniInputAttributeStorage::Float, 3, NumVertices * 3,
+		EHoudiniInputAttributeCompression::None, false);  // v@N
+	SHMGeoInput.AppendAttribute(HAPI_ATTRIB_TANGENT, EHoudiniAttributeOwner::Vertex, EHoudiniInputAttributeStorage::Float, 3, NumVertices * 3,
+		EHoudiniInputAttributeCompression::None, false);  // v@tangenu
+	SHMGeoInput.AppendAttribute(HAPI_ATTRIB_TANGENT2, EHoudiniAttributeOwner::Vertex, EHoudiniInputAttributeStorage::Float, 3, NumVertices * 3,
+		EHoudiniInputAttributeCompression::None, false);  // v@tangenv
 	if (bImportVertexColor)
 	{
-		SHMGeoInput.AppendAttribute(HAPI_ATTRIB_COLOR, EHoudiniAttributeOwner::Vertex, EHoudiniInputAttributeStorage::Float, 3, NumVertices * 3);  // v@Cd
-		SHMGeoInput.AppendAttribute(HAPI_ALPHA, EHoudiniAttributeOwner::Vertex, EHoudiniInputAttributeStorage::Float, 1, NumVertices);  // f@Alpha
+		SHMGeoInput.AppendAttribute(HAPI_ATTRIB_COLOR, EHoudiniAttributeOwner::Vertex, EHoudiniInputAttributeStorage::Float, 3, bUniformColor ? 3 : NumVertices * 3,
+			bUniformColor ? EHoudiniInputAttributeCompression::UniqueValue : EHoudiniInputAttributeCompression::None, false);  // v@Cd
+		SHMGeoInput.AppendAttribute(HAPI_ALPHA, EHoudiniAttributeOwner::Vertex, EHoudiniInputAttributeStorage::Float, 1, bUniformColor ? 1 : NumVertices,
+			bUniformColor ? EHoudiniInputAttributeCompression::UniqueValue : EHoudiniInputAttributeCompression::None, false);  // f@Alpha
 	}
 	for (uint32 UVChannelIdx = 1; UVChannelIdx <= NumUVChannels; ++UVChannelIdx)
 		SHMGeoInput.AppendAttribute(UVChannelIdx == 1 ? HAPI_ATTRIB_UV : TCHAR_TO_UTF8(*(TEXT(HAPI_ATTRIB_UV) + FString::FromInt(UVChannelIdx))),
-			EHoudiniAttributeOwner::Vertex, EHoudiniInputAttributeStorage::Float, 3, NumVertices * 3);  // v@uv, v@uv2, v@uv3, etc.
+			EHoudiniAttributeOwner::Vertex, EHoudiniInputAttributeStorage::Float, 3, NumVertices * 3,
+			EHoudiniInputAttributeCompression::None, false);  // v@uv, v@uv2, v@uv3, etc.
 
 	if (bShouldImportLodGroups)
 	{
@@ -526,7 +658,7 @@ bool UHoudiniInputStaticMesh::HapiImportRenderData(const UStaticMesh* SM, const
 			(MaterialAttribCompression == EHoudiniInputAttributeCompression::UniqueValue) ? (NumMaterialChars / 4 + 1) : (NumMaterialChars / 4 + 2 + NumTriangles), MaterialAttribCompression);
 	}
 
-	float* const SHM = SHMGeoInput.GetSharedMemory(FString::Printf(TEXT("%08X"), (size_t)SM), InOutHandle);
+	float* const SHM = SHMGeoInput.GetSharedMemory(SHMIdentifier, InOutHandle);
 
 	float* PositionDataPtr = SHM;
 	FMemory::Memcpy(PositionDataPtr, PositionData.GetData(), size_t(PositionData.Num()) * sizeof(float));
@@ -540,9 +672,16 @@ bool UHoudiniInputStaticMesh::HapiImportRenderData(const UStaticMesh* SM, const
 	if (bImportVertexColor)
 	{
 		ColorDataPtr = TangentVDataPtr + NumVertices * 3;
-		AlphaDataPtr = ColorDataPtr + NumVertices * 3;
+		AlphaDataPtr = ColorDataPtr + (bUniformColor ? 3 : NumVertices * 3);
+		if (bUniformColor)
+		{
+			*ColorDataPtr = float(UniformColor->R) / 255.0f;
+			*(ColorDataPtr + 1) = float(UniformColor->G) / 255.0f;
+			*(ColorDataPtr + 2) = float(UniformColor->B) / 255.0f;
+			*AlphaDataPtr = float(UniformColor->A) / 255.0f;
+		}
 	}
-	float* UVsDataPtr = (bImportVertexColor ? (AlphaDataPtr + NumVertices) : (TangentVDataPtr + NumVertices * 3));
+	float* UVsDataPtr = (bImportVertexColor ? (AlphaDataPtr + (bUniformColor ? 1 : NumVertices)) : (TangentVDataPtr + NumVertices * 3));
 	int32* LodDataPtr = (int32*)(UVsDataPtr + NumVertices * NumUVChannels * 3);
 	char* MaterialDataPtr = (char*)(bShouldImportLodGroups ?
 		(float*)(LodDataPtr + NumGroupsToImport * NumTriangles) : (UVsDataPtr + NumVertices * NumUVChannels * 3));
@@ -569,22 +708,7 @@ bool UHoudiniInputStaticMesh::HapiImportRenderData(const UStaticMesh* SM, const
 		const FStaticMeshVertexBuffer& VtxBuffer = RenderMesh.VertexBuffers.StaticMeshVertexBuffer;
 		const uint32 NumCurrUVChannels = VtxBuffer.GetNumTexCoords();
 
-		const FColorVertexBuffer* ColorVertexBuffer = nullptr;
-		if (bImportVertexColor)
-		{
-			if (SMC && SMC->LODData.IsValidIndex(LodIdx))
-			{
-				ColorVertexBuffer = SMC->LODData[LodIdx].OverrideVertexColors;
-				if (ColorVertexBuffer && (ColorVertexBuffer->GetNumVertices() != VtxBuffer.GetNumVertices()))
-					ColorVertexBuffer = nullptr;
-			}
-			
-			if (!ColorVertexBuffer)
-				ColorVertexBuffer = &RenderMesh.VertexBuffers.ColorVertexBuffer;
-
-			if (ColorVertexBuffer->GetNumVertices() != VtxBuffer.GetNumVertices())
-				ColorVertexBuffer = nullptr;
-		}
+		const FColorVertexBuffer* ColorVertexBuffer = (bImportVertexColor && !bUniformColor) ? GetImportColorVertexBuffer(SMC, LodIdx, RenderMesh) : nullptr;
 
 		size_t NumCurrTriangles = 0;
 		for (const FStaticMeshSection& Section : RenderMesh.Sections)
@@ -623,44 +747,46 @@ bool UHoudiniInputStaticMesh::HapiImportRenderData(const UStaticMesh* SM, const
 		
 		// Attributes
 		FIndexArrayView RawIndices = RenderMesh.IndexBuffer.GetArrayView();
-		for (uint32 TriIdx = 0; TriIdx < NumCurrTriangles; ++TriIdx)
+		ParallelFor(FMath::DivideAndRoundUp(int32(NumCurrTriangles), HOUDINI_SHM_PACK_CHUNK_SIZE), [&](int32 ChunkIdx)
 		{
-			for (uint32 TriVtxIdx = 0; TriVtxIdx < 3; ++TriVtxIdx)
+			const uint32 EndTriIdx = FMath::Min(uint32(ChunkIdx + 1) * HOUDINI_SHM_PACK_CHUNK_SIZE, uint32(NumCurrTriangles));
+			for (uint32 TriIdx = uint32(ChunkIdx) * HOUDINI_SHM_PACK_CHUNK_SIZE; TriIdx < EndTriIdx; ++TriIdx)
 			{
-				const uint32 RawIdx = RawIndices[TriIdx * 3 + TriVtxIdx];  // Original RenderMesh Vertex Index
-				const uint32 VtxIdx = TriIdx * 3 + 2 - TriVtxIdx;  // Houdini polygon vertex index
+				for (uint32 TriVtxIdx = 0; TriVtxIdx < 3; ++TriVtxIdx)
+				{
+					const uint32 RawIdx = RawIndices[TriIdx * 3 + TriVtxIdx];  // Original RenderMesh Vertex Index
+					const uint32 VtxIdx = TriIdx * 3 + 2 - TriVtxIdx;  // Houdini polygon vertex index
 
-				const FVector3f Normal = VtxBuffer.VertexTangentZ(RawIdx);
-				COPY_VERTEX_VECTOR3f_DATA(NormalDataPtr, Normal);
+					const FVector3f Normal = VtxBuffer.VertexTangentZ(RawIdx);
+					COPY_VERTEX_VECTOR3f_DATA(NormalDataPtr, Normal);
 
-				const FVector4f Tangent = VtxBuffer.VertexTangentX(RawIdx);
-				COPY_VERTEX_VECTOR3f_DATA(TangentUDataPtr, Tangent);
+					const FVector4f Tangent = VtxBuffer.VertexTangentX(RawIdx);
+					COPY_VERTEX_VECTOR3f_DATA(TangentUDataPtr, Tangent);
 
-				const FVector3f Binormal = VtxBuffer.VertexTangentY(RawIdx);
-				COPY_VERTEX_VECTOR3f_DATA(TangentVDataPtr, Binormal);
+					const FVector3f Binormal = VtxBuffer.VertexTangentY(RawIdx);
+					COPY_VERTEX_VECTOR3f_DATA(TangentVDataPtr, Binormal);
 
-				if (ColorDataPtr && AlphaDataPtr)
-				{
-					const FColor VertexColor = ColorVertexBuffer ? ColorVertexBuffer->VertexColor(RawIdx) : FColor::White;
-					float* CurrColorDataPtr = ColorDataPtr + (NumPrevVertices + VtxIdx) * 3;
-					*CurrColorDataPtr = float(VertexColor.R) / 255.0f;
-					*(CurrColorDataPtr + 1) = float(VertexColor.G) / 255.0f;
-					*(CurrColorDataPtr + 2) = float(VertexColor.B) / 255.0f;
-					*(AlphaDataPtr + NumPrevVertices + VtxIdx) = float(VertexColor.A) / 255.0f;
-				}
+					if (ColorDataPtr && AlphaDataPtr && !bUniformColor)
+					{
+						const FColor VertexColor = ColorVertexBuffer ? ColorVertexBuffer->VertexColor(RawIdx) : FColor::White;
+						float* CurrColorDataPtr = ColorDataPtr + (NumPrevVertices + VtxIdx) * 3;
+						*CurrColorDataPtr = float(VertexColor.R) / 255.0f;
+						*(CurrColorDataPtr + 1) = float(VertexColor.G) / 255.0f;
+						*(CurrColorDataPtr + 2) = float(VertexColor.B) / 255.0f;
+						*(AlphaDataPtr + NumPrevVertices + VtxIdx) = float(VertexColor.A) / 255.0f;
+					}
 
-				for (uint32 UVChannelIdx = 0; UVChannelIdx < NumUVChannels; ++UVChannelIdx)
-				{
-					if (UVChannelIdx < NumCurrUVChannels)
+					for (uint32 UVChannelIdx = 0; UVChannelIdx < NumUVChannels; ++UVChannelIdx)
 					{
-						const FVector2f UV = VtxBuffer.GetVertexUV(RawIdx, UVChannelIdx);
+						const FVector2f UV = (UVChannelIdx < NumCurrUVChannels) ? VtxBuffer.GetVertexUV(RawIdx, UVChannelIdx) : FVector2f(0.0f, 1.0f);
 						float* CurrUVsDataPtr = UVsDataPtr + (UVChannelIdx * NumVertices + NumPrevVertices + VtxIdx) * 3;
 						*CurrUVsDataPtr = UV.X;
 						*(CurrUVsDataPtr + 1) = 1.0f - UV.Y;
+						*(CurrUVsDataPtr + 2) = 0.0f;
 					}
 				}
 			}
-		}
+		});
 
 		NumPrevVertices += NumCurrTriangles * 3;
 		NumPrevTriangles += NumCurrTriangles;
@@ -670,9 +796,236 @@ bool UHoudiniInputStaticMesh::HapiImportRenderData(const UStaticMesh* SM, const
 		HOUDINI_FAIL_RETURN(FHoudiniSharedMemoryGeometryInput::HapiCreateNode(GeoNodeId,
 			FString::Printf(TEXT("mesh_%s_%08X"), *SM->GetName(), FPlatformTime::Cycles()), InOutSHMInputNodeId));
 	
+	OutSHMGeoInput = MakeShared<FHoudiniSharedMemoryGeometryInput>(SHMGeoInput);  // Keep the layout, so that we could re-upload without packing again
+
 	return SHMGeoInput.HapiUpload(InOutSHMInputNodeId, SHM);
 }
 
+// -------- StaticMesh import cache --------
+struct FHoudiniStaticMeshImportCacheEntry
+{
+	int32 NodeId = -1;  // The "sharedmemory_geometryinput" node, will be -1 after session invalidated
+	int32 UniqueId = -1;
+	int32 ParentNodeId = -1;  // The auto created obj container
+	FString NodePath;
+	size_t Handle = 0;
+	TSharedPtr<FHoudiniSharedMemoryGeometryInput> SHMGeoInput;  // Keep the packed data layout, so that we could revive the node after session restarted
+	TMap<int32, int32> Users;  // Object merge NodeId -> UniqueId
+
+	bool HapiCacheNodeInfo()
+	{
+		HAPI_NodeInfo NodeInfo;
+		HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetNodeInfo(FHoudiniEngine::Get().GetSession(), NodeId, &NodeInfo));
+		UniqueId = NodeInfo.uniqueHoudiniNodeId;
+		ParentNodeId = NodeInfo.parentId;
+		HAPI_StringHandle NodePathSH;
+		HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetNodePath(FHoudiniEngine::Get().GetSession(), NodeId, -1, &NodePathSH));
+		return FHoudiniEngineUtils::HapiConvertStringHandle(NodePathSH, NodePath);
+	}
+
+	void Release()
+	{
+		if (NodeId >= 0)
+			FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), (ParentNodeId >= 0) ? ParentNodeId : NodeId);
+		if (Handle)
+			FHoudiniEngineUtils::CloseSharedMemoryHandle(Handle);
+	}
+};
+
+struct FHoudiniStaticMeshImportCache
+{
+	FCriticalSection Lock;  // Guard Entries, and also avoid same mesh being imported twice at the same time
+	TMap<FString, FHoudiniStaticMeshImportCacheEntry> Entries;
+	bool bSweepPending = false;  // Checking users needs a HAPI call per user, so only sweep once per cook batch, see RequestImportCacheSweep()
+};
+
+static FCriticalSection GHoudiniStaticMeshImportCachesLock;
+static TMap<int32, TSharedPtr<FHoudiniStaticMeshImportCache>> GHoudiniStaticMeshImportCaches;  // SessionIdx -> Cache
+
+static bool HapiIsNodeValid(const int32& NodeId, const int32& UniqueId)
+{
+	HAPI_Bool bValid = false;
+	return (NodeId >= 0) && (HAPI_RESULT_SUCCESS == FHoudiniApi::IsNodeValid(FHoudiniEngine::Get().GetSession(), NodeId, UniqueId, &bValid)) && bValid;
+}
+
+static bool GetStaticMeshImportCacheKey(const UStaticMesh* SM, const UStaticMeshComponent* SMC, const FHoudiniInputSettings& Settings, FString& OutKey)
+{
+	OutKey = FString::Printf(TEXT("%d;%d;%d;"), int32(Settings.bImportRenderData), int32(Settings.LODImportMethod), int32(Settings.CollisionImportMethod));
+
+	// DerivedDataKey has already hashed the source models and build settings, so it changes whenever mesh content changes
+	bool bHasContentHash = false;
+#if WITH_EDITORONLY_DATA
+	if (const FStaticMeshRenderData* RenderData = SM->GetRenderData())
+	{
+		if (!RenderData->DerivedDataKey.IsEmpty())
+		{
+			OutKey += RenderData->DerivedDataKey;
+			bHasContentHash = true;
+		}
+	}
+
+	if (bHasContentHash && Settings.CollisionImportMethod != EHoudiniMeshCollisionImportMethod::NoImportCollision && IsValid(SM->ComplexCollisionMesh))
+	{
+		const FStaticMeshRenderData* CollisionRenderData = SM->ComplexCollisionMesh->GetRenderData();
+		if (CollisionRenderData && !CollisionRenderData->DerivedDataKey.IsEmpty())
+			OutKey += TEXT(";") + CollisionRenderData->DerivedDataKey;
+		else
+			bHasContentHash = false;
+	}
+#endif
+	if (!bHasContentHash)
+		OutKey += SM->GetPathName();
+
+	const TArray<FStaticMaterial>& MaterialSlots = SM->GetStaticMaterials();
+	for (const FStaticMaterial& MaterialSlot : MaterialSlots)
+	{
+		const UMaterialInterface* Material = IsValid(SMC) ?
+			SMC->GetMaterial(SMC->GetMaterialIndex(MaterialSlot.ImportedMaterialSlotName)) : MaterialSlot.MaterialInterface.Get();
+		OutKey += TEXT(";") + (IsValid(Material) ? FHoudiniEngineUtils::GetAssetReference(Material) : FString());
+	}
+
+	if (Settings.bImportRenderData && IsValid(SMC))  // Override vertex colors are unique to this component
+	{
+		for (const FStaticMeshComponentLODInfo& LODInfo : SMC->LODData)
+		{
+			if (LODInfo.OverrideVertexColors)
+			{
+				OutKey += TEXT(";") + SMC->GetPathName();
+				break;
+			}
+		}
+	}
+
+	return bHasContentHash;
+}
+
+bool UHoudiniInputStaticMesh::HapiImport(const UStaticMesh* SM, const UStaticMeshComponent* SMC,
+	const FHoudiniInputSettings& Settings, const int32& GeoNodeId, int32& InOutMeshNodeId, size_t& InOutHandle)
+{
+	FString Key;
+	const bool bHasContentHash = GetStaticMeshImportCacheKey(SM, SMC, Settings, Key);
+
+	TSharedPtr<FHoudiniStaticMeshImportCache> Cache;
+	{
+		FScopeLock ScopeLock(&GHoudiniStaticMeshImportCachesLock);
+		TSharedPtr<FHoudiniStaticMeshImportCache>& FoundCache = GHoudiniStaticMeshImportCaches.FindOrAdd(FHoudiniEngine::GetCurrentSessionIndex());
+		if (!FoundCache.IsValid())
+			FoundCache = MakeShared<FHoudiniStaticMeshImportCache>();
+		Cache = FoundCache;
+	}
+
+	FScopeLock ScopeLock(&Cache->Lock);
+
+	FHoudiniStaticMeshImportCacheEntry& Entry = Cache->Entries.FindOrAdd(Key);
+	const bool bNodeValid = HapiIsNodeValid(Entry.NodeId, Entry.UniqueId);
+	if (!bNodeValid)
+	{
+		Entry.NodeId = -1;
+		Entry.Users.Empty();
+	}
+
+	if (!bNodeValid && bHasContentHash && Entry.SHMGeoInput.IsValid() && Entry.Handle)  // Session restarted, data in shared memory is still valid, so just re-upload it
+	{
+		HOUDINI_FAIL_RETURN(FHoudiniSharedMemoryGeometryInput::HapiCreateNode(-1,
+			FString::Printf(TEXT("mesh_%s_%08X"), *SM->GetName(), FPlatformTime::Cycles()), Entry.NodeId));
+		HOUDINI_FAIL_RETURN(Entry.SHMGeoInput->HapiUpload(Entry.NodeId, nullptr));
+	}
+	else if (!bNodeValid || !bHasContentHash)  // Could NOT identify the mesh content, so always re-import it
+	{
+		const FString SHMIdentifier = FString::Printf(TEXT("smc%08X"), FCrc::StrCrc32(*Key));
+		HOUDINI_FAIL_RETURN(Settings.bImportRenderData ?
+			HapiImportRenderData(SM, SMC, Settings, -1, Entry.NodeId, Entry.Handle, SHMIdentifier, Entry.SHMGeoInput) :
+			HapiImportMeshDescription(SM, SMC, Settings, -1, Entry.NodeId, Entry.Handle, SHMIdentifier, Entry.SHMGeoInput));
+	}
+
+	if (!bNodeValid)
+		HOUDINI_FAIL_RETURN(Entry.HapiCacheNodeInfo());
+
+	if (!bNodeValid && Cache->bSweepPending)
+	{
+		Cache->bSweepPending = false;
+
+		// Release the entries that no longer referenced by any node, entries invalidated with session will be released in InvalidateImportCache()
+		for (auto EntryIter = Cache->Entries.CreateIterator(); EntryIter; ++EntryIter)
+		{
+			FHoudiniStaticMeshImportCacheEntry& OtherEntry = EntryIter->Value;
+			if ((&OtherEntry == &Entry) || (OtherEntry.NodeId < 0))
+				continue;
+
+			for (auto UserIter = OtherEntry.Users.CreateIterator(); UserIter; ++UserIter)
+			{
+				if (!HapiIsNodeValid(UserIter->Key, UserIter->Value))
+					UserIter.RemoveCurrent();
+			}
+
+			if (OtherEntry.Users.IsEmpty())
+			{
+				OtherEntry.Release();
+				EntryIter.RemoveCurrent();
+			}
+		}
+	}
+
+	if (InOutMeshNodeId < 0)
+		HOUDINI_FAIL_RETURN(FHoudiniSopObjectMerge::HapiCreateNode(GeoNodeId,
+			FString::Printf(TEXT("mesh_%s_%08X"), *SM->GetName(), FPlatformTime::Cycles()), InOutMeshNodeId));
+
+	if (!Entry.Users.Contains(InOutMeshNodeId))
+	{
+		for (TPair<FString, FHoudiniStaticMeshImportCacheEntry>& OtherEntry : Cache->Entries)
+			OtherEntry.Value.Users.Remove(InOutMeshNodeId);
+
+		HOUDINI_FAIL_RETURN(FHoudiniSopObjectMerge::HapiSetObjectPath(InOutMeshNodeId, Entry.NodePath));
+
+		HAPI_NodeInfo NodeInfo;
+		HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetNodeInfo(FHoudiniEngine::Get().GetSession(), InOutMeshNodeId, &NodeInfo));
+		Entry.Users.Add(InOutMeshNodeId, NodeInfo.uniqueHoudiniNodeId);
+	}
+
+	if (InOutHandle)  // Mesh data now owned by cache
+	{
+		FHoudiniEngineUtils::CloseSharedMemoryHandle(InOutHandle);
+		InOutHandle = 0;
+	}
+
+	return true;
+}
+
+void UHoudiniInputStaticMesh::RequestImportCacheSweep()
+{
+	FScopeLock ScopeLock(&GHoudiniStaticMeshImportCachesLock);
+	for (const TPair<int32, TSharedPtr<FHoudiniStaticMeshImportCache>>& SessionCache : GHoudiniStaticMeshImportCaches)
+	{
+		FScopeLock CacheLock(&SessionCache.Value->Lock);
+		SessionCache.Value->bSweepPending = true;
+	}
+}
+
+void UHoudiniInputStaticMesh::InvalidateImportCache()
+{
+	FScopeLock ScopeLock(&GHoudiniStaticMeshImportCachesLock);
+	for (const TPair<int32, TSharedPtr<FHoudiniStaticMeshImportCache>>& SessionCache : GHoudiniStaticMeshImportCaches)
+	{
+		FScopeLock CacheLock(&SessionCache.Value->Lock);
+		for (auto EntryIter = SessionCache.Value->Entries.CreateIterator(); EntryIter; ++EntryIter)
+		{
+			FHoudiniStaticMeshImportCacheEntry& Entry = EntryIter->Value;
+			if (Entry.NodeId < 0)  // Has NOT been used since last invalidation, so we need NOT keep the data
+			{
+				if (Entry.Handle)
+					FHoudiniEngineUtils::CloseSharedMemoryHandle(Entry.Handle);
+				EntryIter.RemoveCurrent();
+				continue;
+			}
+
+			Entry.NodeId = -1;
+			Entry.UniqueId = -1;
+			Entry.ParentNodeId = -1;
+			Entry.Users.Empty();
+		}
+	}
+}
+
 bool UHoudiniInputStaticMesh::AppendBoundInfo(const UStaticMesh* SM, FString& InOutInfoStr)
 {
 	if (SM)
@@ -214,6 +214,9 @@ bool AHoudiniNode::HapiUploadInputsAndParameters()
 
 	const double InputUploadedTime = FPlatformTime::Seconds();
 
+	if (Preset.IsValid() || bRebuildBeforeCook)
+		bParmsUploadedSinceSync = true;
+
 	if (Preset.IsValid())
 	{
 		TArray<UHoudiniParameter*> ParmsToUpload;
@@ -265,6 +268,7 @@ bool AHoudiniNode::HapiUploadInputsAndParameters()
 			UHoudiniParameter* Parm = Parms[ParmIdx];
 			if (Parm->HasChanged())
 			{
+				bParmsUploadedSinceSync = true;
 				HOUDINI_FAIL_RETURN(Parm->HapiUpload());
 				Parm->ResetModification();
 			}
@@ -282,7 +286,10 @@ bool AHoudiniNode::HapiUploadInputsAndParameters()
 	for (UHoudiniInput* Input : Inputs)
 	{
 		if (Input->GetType() == EHoudiniInputType::Mask && Input->Holders.Num() == 1)
+		{
+			bParmsUploadedSinceSync = true;  // Mask data will be uploaded to IntParmInsts
 			HOUDINI_FAIL_RETURN(Cast<UHoudiniInputMask>(Input->Holders[0])->HapiUploadData());
+		}
 	}
 
 	const double MaskUploadedTime = FPlatformTime::Seconds();
@@ -1009,6 +1016,8 @@ bool UHoudiniInput::HapiRemoveHolder(const int32& RemoveHolderIdx, const bool& b
 		return true;
 	}
 
+	const FHoudiniSessionScope SessionScope(GetNode());  // May be called by editor, outside the cook process
+
 	bool bHasValidHolder = false;  // Check whether there is any valid holder remains
 	for (int32 HolderIdx = 0; HolderIdx < Holders.Num(); ++HolderIdx)
 	{
@@ -1086,6 +1095,8 @@ bool UHoudiniInput::HapiImportActors(const TArray<AActor*>& SelectedActors)
 	if (Type != EHoudiniInputType::World)
 		return true;
 
+	const FHoudiniSessionScope SessionScope(GetNode());  // May be called by editor, outside the cook process
+
 	// Collect all old holders
 	TMap<FName, UHoudiniInputActor*> OldActorHolderMap;
 	TMap<FName, UHoudiniInputLandscape*> OldLandscapeHolderMap;
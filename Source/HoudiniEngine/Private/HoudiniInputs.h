@@ -11,6 +11,8 @@ class ALandscape;
 struct FLandscapeEditDataInterface;
 class ULandscapeLayerInfoObject;
 class UFoliageType_InstancedStaticMesh;
+class FHoudiniSharedMemoryGeometryInput;
+struct FHoudiniLayerUploadTask;
 
 
 UCLASS()
@@ -36,6 +38,8 @@ public:
 	AHoudiniNode* GetNode() const;
 
 	virtual TSoftObjectPtr<UObject> GetObject() const override;
+
+	virtual uint32 GetContentHash() const override;  // Upstream node's last cook key
 };
 
 
@@ -197,19 +201,21 @@ protected:
 	size_t MeshHandle = 0;
 
 	static bool HapiImportMeshDescription(const UStaticMesh* SM, const UStaticMeshComponent* SMC,
-		const FHoudiniInputSettings& Settings, const int32& GeoNodeId, int32& InOutSHMInputNodeId, size_t& InOutHandle);
+		const FHoudiniInputSettings& Settings, const int32& GeoNodeId, int32& InOutSHMInputNodeId, size_t& InOutHandle,
+		const FString& SHMIdentifier, TSharedPtr<FHoudiniSharedMemoryGeometryInput>& OutSHMGeoInput);
 
 	static bool HapiImportRenderData(const UStaticMesh* SM, const UStaticMeshComponent* SMC,
-		const FHoudiniInputSettings& Settings, const int32& GeoNodeId, int32& InOutSHMInputNodeId, size_t& InOutHandle);
+		const FHoudiniInputSettings& Settings, const int32& GeoNodeId, int32& InOutSHMInputNodeId, size_t& InOutHandle,
+		const FString& SHMIdentifier, TSharedPtr<FHoudiniSharedMemoryGeometryInput>& OutSHMGeoInput);
 
 public:
-	FORCEINLINE static bool HapiImport(const UStaticMesh* SM, const UStaticMeshComponent* SMC,
-		const FHoudiniInputSettings& Settings, const int32& GeoNodeId, int32& InOutSHMInputNodeId, size_t& InOutHandle)
-	{
-		return Settings.bImportRenderData ?
-			HapiImportRenderData(SM, SMC, Settings, GeoNodeId, InOutSHMInputNodeId, InOutHandle) :
-			HapiImportMeshDescription(SM, SMC, Settings, GeoNodeId, InOutSHMInputNodeId, InOutHandle);
-	}
+	// Identical mesh content will only be uploaded once per session, InOutMeshNodeId will be an "object_merge" of the cached mesh node
+	static bool HapiImport(const UStaticMesh* SM, const UStaticMeshComponent* SMC,
+		const FHoudiniInputSettings& Settings, const int32& GeoNodeId, int32& InOutMeshNodeId, size_t& InOutHandle);
+
+	static void RequestImportCacheSweep();  // Called when a cook batch starts, the next cache miss of each session will release entries no longer used
+
+	static void InvalidateImportCache();  // Called when session invalidated, cached mesh data will be re-uploaded lazily
 
 	static bool AppendBoundInfo(const UStaticMesh* InSM, FString& InOutInfoStr);
 
@@ -549,6 +555,8 @@ protected:
 
 	mutable TWeakObjectPtr<AActor> Actor;
 
+	void GetComponents(const AActor* A, TArray<const UActorComponent*>& OutComponents, TArray<FTransform>& OutTransforms) const;  // Components filtered by settings, same as uploaded
+
 public:
 	static UHoudiniInputActor* Create(UHoudiniInput* Input, AActor* Actor);
 
@@ -561,6 +569,8 @@ public:
 	virtual TSoftObjectPtr<UObject> GetObject() const override { return GetActor(); }
 
 	virtual bool HapiUpload() override;
+
+	virtual uint32 GetContentHash() const override;
 };
 
 
@@ -577,8 +587,10 @@ struct HOUDINIENGINE_API FHoudiniLayerImportInfo
 
 	FIntRect ChangedExtent = INVALID_LANDSCAPE_EXTENT;  // Absolute extent, if ChangedExtent is valid, means we should upload partially
 
-	bool HapiUpload(FLandscapeEditDataInterface& LandscapeEdit,
-		const FName& EditLayerName, ULandscapeLayerInfoObject* LayerInfo,  // LayerInfo == nullptr, means we should import height
+	void Pack(FLandscapeEditDataInterface& LandscapeEdit, FHoudiniLayerUploadTask& Task,  // Fetch data in order as LandscapeEdit is NOT thread-safe, then pack it to shm asynchronously
+		const FIntRect& LandscapeExtent);
+
+	bool HapiUpload(FHoudiniLayerUploadTask& Task,  // Will wait for the pack task
 		const float& ZScale, const FIntRect& LandscapeExtent,
 		const int32& GeoNodeId);
 
@@ -658,6 +670,8 @@ public:
 	virtual bool HapiDestroy() override;
 
 	virtual void Invalidate() override;
+
+	virtual uint32 GetContentHash() const override;  // Identify by landscape component textures, rather than the actor
 };
 
 
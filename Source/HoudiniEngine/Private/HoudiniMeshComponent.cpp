@@ -4,6 +4,7 @@
 #include "HoudiniMeshSceneProxy.h"
 
 #include "MeshUtilitiesCommon.h"
+#include "Async/ParallelFor.h"
 #include "UObject/ObjectSaveContext.h"
 
 #include "HoudiniParameterAttribute.h"
@@ -29,6 +30,7 @@ int32 UHoudiniMeshComponent::NumVertices() const
 
 void UHoudiniMeshComponent::AddTriangle(const FIntVector3& Triangle, const int32& SectionIdx)
 {
+	MarkDerivedTangentsDirty();
 	Sections[SectionIdx].TriangleIndices.Add(Triangles.Add(Triangle));
 }
 
@@ -95,6 +97,7 @@ int32 UHoudiniMeshComponent::AddSection(UMaterialInterface* Material)
 void UHoudiniMeshComponent::SetNormalData(const EHoudiniAttributeOwner& Owner, const TArray<float>& Data,
 	const TArray<int32>& PointIndices, const TArray<int32>& TriangleIndices)
 {
+	MarkDerivedTangentsDirty();
 	NormalOwner = Owner;
 	COPY_MESH_ATTRIB_DATA(FVector3f, 3, NormalData,
 		AttribValue.X = Data[DataIdx];
@@ -105,6 +108,7 @@ void UHoudiniMeshComponent::SetNormalData(const EHoudiniAttributeOwner& Owner, c
 void UHoudiniMeshComponent::SetTangentUData(const EHoudiniAttributeOwner& Owner, const TArray<float>& Data,
 	const TArray<int32>& PointIndices, const TArray<int32>& TriangleIndices)
 {
+	MarkDerivedTangentsDirty();
 	TangentUOwner = Owner;
 	COPY_MESH_ATTRIB_DATA(FVector3f, 3, TangentUData,
 		AttribValue.X = Data[DataIdx];
@@ -115,6 +119,7 @@ void UHoudiniMeshComponent::SetTangentUData(const EHoudiniAttributeOwner& Owner,
 void UHoudiniMeshComponent::SetTangentVData(const EHoudiniAttributeOwner& Owner, const TArray<float>& Data,
 	const TArray<int32>& PointIndices, const TArray<int32>& TriangleIndices)
 {
+	MarkDerivedTangentsDirty();
 	TangentVOwner = Owner;
 	COPY_MESH_ATTRIB_DATA(FVector3f, 3, TangentVData,
 		AttribValue.X = Data[DataIdx];
@@ -217,6 +222,7 @@ void UHoudiniMeshComponent::SetColorData(const EHoudiniAttributeOwner& CdOwner,
 void UHoudiniMeshComponent::SetUVData(const TArray<EHoudiniAttributeOwner>& Owners, const TArray<TArray<float>>& Datas,
 	const TArray<int32>& PointIndices, const TArray<int32>& TriangleIndices)
 {
+	MarkDerivedTangentsDirty();
 	for (int32 UVIdx = 0; UVIdx < Owners.Num(); ++UVIdx)
 	{
 		const EHoudiniAttributeOwner& Owner = Owners[UVIdx];
@@ -233,6 +239,7 @@ void UHoudiniMeshComponent::SetUVData(const TArray<EHoudiniAttributeOwner>& Owne
 
 void UHoudiniMeshComponent::ComputeNormal()
 {
+	MarkDerivedTangentsDirty();
 	NormalOwner = EHoudiniAttributeOwner::Point;
 
 	NormalData.SetNumZeroed(Positions.Num());
@@ -275,6 +282,203 @@ void UHoudiniMeshComponent::ComputeNormal()
 }
 
 
+#define HOUDINI_MESH_TANGENT_BATCH_SIZE 1024
+
+template<typename TAttribValue>
+static FORCEINLINE const TAttribValue& GetMeshAttribValue(const EHoudiniAttributeOwner& Owner, const TArray<TAttribValue>& Data,
+	const int32& VtxIdx, const int32& PtIdx, const int32& TriIdx)
+{
+	switch (Owner)
+	{
+	case EHoudiniAttributeOwner::Vertex: return Data[VtxIdx];
+	case EHoudiniAttributeOwner::Point: return Data[PtIdx];
+	case EHoudiniAttributeOwner::Prim: return Data[TriIdx];
+	}
+	return Data[0];
+}
+
+static FORCEINLINE void OrthonormalizeTangent(const FVector3f& Normal, const FVector3f& AccumTangentU, const FVector3f& AccumTangentV,
+	FVector3f& OutTangentU, FVector3f& OutTangentV)
+{
+	// Gram-Schmidt, then rebuild tangentv by cross product, keep the handedness of uv
+	OutTangentU = (AccumTangentU - Normal * FVector3f::DotProduct(Normal, AccumTangentU)).GetSafeNormal();
+	if (OutTangentU.IsZero())
+	{
+		Normal.FindBestAxisVectors(OutTangentU, OutTangentV);
+		return;
+	}
+
+	OutTangentV = FVector3f::CrossProduct(Normal, OutTangentU);
+	if (FVector3f::DotProduct(OutTangentV, AccumTangentV) < 0.0f)
+		OutTangentV = -OutTangentV;
+}
+
+// Vertices sharing the same key will share the accumulated tangents
+struct FHoudiniTangentWeldKey
+{
+	int32 PtIdx;
+	FVector2f UV;
+	FVector3f Normal;
+	bool bFlipped;
+
+	FORCEINLINE bool operator==(const FHoudiniTangentWeldKey& Other) const
+	{
+		return (PtIdx == Other.PtIdx) && (UV == Other.UV) && (Normal == Other.Normal) && (bFlipped == Other.bFlipped);
+	}
+
+	FORCEINLINE friend uint32 GetTypeHash(const FHoudiniTangentWeldKey& Key)
+	{
+		uint32 Hash = HashCombine(GetTypeHash(Key.PtIdx), HashCombine(GetTypeHash(Key.UV.X), GetTypeHash(Key.UV.Y)));
+		Hash = HashCombine(Hash, HashCombine(GetTypeHash(Key.Normal.X), HashCombine(GetTypeHash(Key.Normal.Y), GetTypeHash(Key.Normal.Z))));
+		return Key.bFlipped ? ~Hash : Hash;
+	}
+};
+
+void UHoudiniMeshComponent::UpdateDerivedTangents() const
+{
+	if (!bDerivedTangentsDirty)
+		return;
+
+	bDerivedTangentsDirty = false;
+	DerivedTangentOwner = EHoudiniAttributeOwner::Invalid;
+	DerivedTangentUData.Empty();
+	DerivedTangentVData.Empty();
+
+	if ((!TangentUData.IsEmpty() && !TangentVData.IsEmpty()) || NormalData.IsEmpty())  // We should compute both tangentu and tangentv
+		return;
+
+	auto IsPerPointLambda = [](const EHoudiniAttributeOwner& Owner)
+		{
+			return (Owner == EHoudiniAttributeOwner::Point) || (Owner == EHoudiniAttributeOwner::Detail);
+		};
+
+	const FHoudiniMeshUV* UV = UVs.IsEmpty() ? nullptr : &UVs[0];  // Tangents follow the first uv, as normal maps sample it
+	const bool bPerPoint = IsPerPointLambda(NormalOwner) && (!UV || IsPerPointLambda(UV->Owner));
+	DerivedTangentOwner = bPerPoint ? EHoudiniAttributeOwner::Point : EHoudiniAttributeOwner::Vertex;
+	const int32 NumElems = bPerPoint ? Positions.Num() : Triangles.Num() * 3;
+	DerivedTangentUData.SetNumUninitialized(NumElems);
+	DerivedTangentVData.SetNumUninitialized(NumElems);
+
+	if (!UV)  // Without uv, tangents could only be derived from normals
+	{
+		ParallelFor(FMath::DivideAndRoundUp(NumElems, HOUDINI_MESH_TANGENT_BATCH_SIZE), [&](int32 BatchIdx)
+			{
+				const int32 EndElemIdx = FMath::Min((BatchIdx + 1) * HOUDINI_MESH_TANGENT_BATCH_SIZE, NumElems);
+				for (int32 ElemIdx = BatchIdx * HOUDINI_MESH_TANGENT_BATCH_SIZE; ElemIdx < EndElemIdx; ++ElemIdx)
+				{
+					const FVector3f& Normal = bPerPoint ? GetMeshAttribValue(NormalOwner, NormalData, 0, ElemIdx, 0) :
+						GetMeshAttribValue(NormalOwner, NormalData, ElemIdx, Triangles[ElemIdx / 3][2 - ElemIdx % 3], ElemIdx / 3);
+					Normal.FindBestAxisVectors(DerivedTangentUData[ElemIdx], DerivedTangentVData[ElemIdx]);
+				}
+			});
+
+		return;
+	}
+
+	// -------- Compute tangents of each triangle by uv derivatives --------
+	const int32 NumTris = Triangles.Num();
+	TArray<FVector3f> TriTangentUs;
+	TArray<FVector3f> TriTangentVs;
+	TArray<bool> bTriFlippeds;  // Whether uv of this triangle is mirrored
+	TriTangentUs.SetNumUninitialized(NumTris);
+	TriTangentVs.SetNumUninitialized(NumTris);
+	bTriFlippeds.SetNumUninitialized(NumTris);
+	ParallelFor(FMath::DivideAndRoundUp(NumTris, HOUDINI_MESH_TANGENT_BATCH_SIZE), [&](int32 BatchIdx)
+		{
+			const int32 EndTriIdx = FMath::Min((BatchIdx + 1) * HOUDINI_MESH_TANGENT_BATCH_SIZE, NumTris);
+			for (int32 TriIdx = BatchIdx * HOUDINI_MESH_TANGENT_BATCH_SIZE; TriIdx < EndTriIdx; ++TriIdx)
+			{
+				const FIntVector& Triangle = Triangles[TriIdx];
+				const FVector3f Edge1 = Positions[Triangle.Y] - Positions[Triangle.X];
+				const FVector3f Edge2 = Positions[Triangle.Z] - Positions[Triangle.X];
+				const FVector2f& UV0 = GetMeshAttribValue(UV->Owner, UV->Data, TriIdx * 3 + 2, Triangle.X, TriIdx);
+				const FVector2f DeltaUV1 = GetMeshAttribValue(UV->Owner, UV->Data, TriIdx * 3 + 1, Triangle.Y, TriIdx) - UV0;
+				const FVector2f DeltaUV2 = GetMeshAttribValue(UV->Owner, UV->Data, TriIdx * 3, Triangle.Z, TriIdx) - UV0;
+
+				const float Det = DeltaUV1.X * DeltaUV2.Y - DeltaUV2.X * DeltaUV1.Y;
+				bTriFlippeds[TriIdx] = Det < 0.0f;
+				if (FMath::IsNearlyZero(Det, UE_SMALL_NUMBER))  // Degenerated uv, will NOT contribute to points
+				{
+					TriTangentUs[TriIdx] = FVector3f::ZeroVector;
+					TriTangentVs[TriIdx] = FVector3f::ZeroVector;
+					continue;
+				}
+
+				TriTangentUs[TriIdx] = ((Edge1 * DeltaUV2.Y - Edge2 * DeltaUV1.Y) / Det).GetSafeNormal();
+				TriTangentVs[TriIdx] = ((Edge2 * DeltaUV1.X - Edge1 * DeltaUV2.X) / Det).GetSafeNormal();
+			}
+		});
+
+	// -------- Accumulate by corner angles --------
+	// Per point: seperate mirrored uvs, so that tangents will NOT cancel out on mirror seams.
+	// Per vertex: like MikkTSpace, only weld vertices with the same point, uv, normal and mirroring, so uv islands meeting at a point will NOT blend
+	const int32 NumPoints = Positions.Num();
+	TArray<int32> VtxAccumIndices;  // Only used when !bPerPoint, NumElems
+	int32 NumAccums = NumPoints * 2;
+	if (!bPerPoint)
+	{
+		TMap<FHoudiniTangentWeldKey, int32> WeldKeyAccumIdxMap;
+		WeldKeyAccumIdxMap.Reserve(NumElems);
+		VtxAccumIndices.SetNumUninitialized(NumElems);
+		for (int32 ElemIdx = 0; ElemIdx < NumElems; ++ElemIdx)
+		{
+			const int32 TriIdx = ElemIdx / 3;
+			const int32 PtIdx = Triangles[TriIdx][2 - ElemIdx % 3];  // Vertex data is in reversed order of triangle points
+			const FHoudiniTangentWeldKey WeldKey{ PtIdx, GetMeshAttribValue(UV->Owner, UV->Data, ElemIdx, PtIdx, TriIdx),
+				GetMeshAttribValue(NormalOwner, NormalData, ElemIdx, PtIdx, TriIdx), bTriFlippeds[TriIdx] };
+			VtxAccumIndices[ElemIdx] = WeldKeyAccumIdxMap.FindOrAdd(WeldKey, WeldKeyAccumIdxMap.Num());
+		}
+		NumAccums = WeldKeyAccumIdxMap.Num();
+	}
+
+	TArray<FVector3f> AccumTangentUs;
+	TArray<FVector3f> AccumTangentVs;
+	AccumTangentUs.SetNumZeroed(NumAccums);
+	AccumTangentVs.SetNumZeroed(NumAccums);
+	for (int32 TriIdx = 0; TriIdx < NumTris; ++TriIdx)
+	{
+		const FIntVector& Triangle = Triangles[TriIdx];
+		const FVector3f& TriTangentU = TriTangentUs[TriIdx];
+		if (TriTangentU.IsZero())
+			continue;
+
+		const FVector3f& TriTangentV = TriTangentVs[TriIdx];
+		const int32 FlipIdx = bTriFlippeds[TriIdx] ? 1 : 0;
+		for (int32 TriVtxIdx = 0; TriVtxIdx < 3; ++TriVtxIdx)
+		{
+			const int32& PtIdx = Triangle[TriVtxIdx];
+			const int32 AccumIdx = bPerPoint ? (FlipIdx * NumPoints + PtIdx) : VtxAccumIndices[TriIdx * 3 + 2 - TriVtxIdx];
+			const float Weight = TriangleUtilities::ComputeTriangleCornerAngle(
+				Positions[PtIdx], Positions[Triangle[(TriVtxIdx + 1) % 3]], Positions[Triangle[(TriVtxIdx + 2) % 3]]);
+			AccumTangentUs[AccumIdx] += TriTangentU * Weight;
+			AccumTangentVs[AccumIdx] += TriTangentV * Weight;
+		}
+	}
+
+	// -------- Orthonormalize by normals --------
+	ParallelFor(FMath::DivideAndRoundUp(NumElems, HOUDINI_MESH_TANGENT_BATCH_SIZE), [&](int32 BatchIdx)
+		{
+			const int32 EndElemIdx = FMath::Min((BatchIdx + 1) * HOUDINI_MESH_TANGENT_BATCH_SIZE, NumElems);
+			for (int32 ElemIdx = BatchIdx * HOUDINI_MESH_TANGENT_BATCH_SIZE; ElemIdx < EndElemIdx; ++ElemIdx)
+			{
+				if (bPerPoint)
+				{
+					// Per point uv could only be mirrored on the whole point, so just pick the dominant side
+					const int32 AccumIdx = (AccumTangentUs[NumPoints + ElemIdx].SizeSquared() > AccumTangentUs[ElemIdx].SizeSquared()) ? (NumPoints + ElemIdx) : ElemIdx;
+					OrthonormalizeTangent(GetMeshAttribValue(NormalOwner, NormalData, 0, ElemIdx, 0),
+						AccumTangentUs[AccumIdx], AccumTangentVs[AccumIdx], DerivedTangentUData[ElemIdx], DerivedTangentVData[ElemIdx]);
+				}
+				else
+				{
+					const int32 TriIdx = ElemIdx / 3;
+					const int32& AccumIdx = VtxAccumIndices[ElemIdx];
+					OrthonormalizeTangent(GetMeshAttribValue(NormalOwner, NormalData, ElemIdx, Triangles[TriIdx][2 - ElemIdx % 3], TriIdx),
+						AccumTangentUs[AccumIdx], AccumTangentVs[AccumIdx], DerivedTangentUData[ElemIdx], DerivedTangentVData[ElemIdx]);
+				}
+			}
+		});
+}
+
 void UHoudiniMeshComponent::SetMaterial(int32 ElementIndex, UMaterialInterface* Material)
 {
 	Sections[ElementIndex].Material = Material;
@@ -757,6 +961,8 @@ FBoxSphereBounds UHoudiniMeshComponent::CalcBounds(const FTransform& InLocalToWo
 
 void UHoudiniMeshComponent::ResetMeshData()
 {
+	MarkDerivedTangentsDirty();
+
 	Positions.Empty();
 	Triangles.Empty();
 
@@ -781,6 +987,7 @@ void UHoudiniMeshComponent::ResetMeshData()
 }
 
 #define TRANSFORM_POSITIONS(TRANSFORM_POSITION) const FTransform& ComponentTransform = GetComponentTransform();\
+	MarkDerivedTangentsDirty();\
 	if (SelectedClass == EHoudiniAttributeOwner::Point)\
 	{\
 		for (const int32& SelectedPointIdx : SelectedIndices)\
@@ -830,7 +1037,8 @@ bool UHoudiniMeshComponent::HapiUpload(const TArray<UHoudiniMeshComponent*>& HMC
 		NumVertices, NumPoints, NumPrims, ChangedClass, PointAttribs, PrimAttribs);
 
 
-	FHoudiniSharedMemoryGeometryInput SHMGeoInput(NumPoints, NumPrims, NumVertices);
+	// Geometry will be fully written, or kept from the previous upload, so need NOT zero it
+	FHoudiniSharedMemoryGeometryInput SHMGeoInput(NumPoints, NumPrims, NumVertices, false);
 	SHMGeoInput.AppendGroup(TCHAR_TO_UTF8(*EditGroupName), EHoudiniAttributeOwner::Prim, 1, true);
 	const bool bPointSelected = ChangedClass == EHoudiniAttributeOwner::Point;
 	const bool bPrimSelected = ChangedClass == EHoudiniAttributeOwner::Prim;
@@ -846,6 +1054,9 @@ bool UHoudiniMeshComponent::HapiUpload(const TArray<UHoudiniMeshComponent*>& HMC
 
 	float* const SHM = SHMGeoInput.GetSharedMemory(FString::Printf(TEXT("mesh_%08x"), SHMInputNodeId), InOutHandle);
 
+	// If the segment still holds the previous upload of the same layout, we only need to rewrite the changed meshes
+	const bool bLayoutUnchanged = FHoudiniSharedMemoryArena::UpdateLayoutKey(InOutHandle, HashCombine(SHMGeoInput.GetLayoutHash(),
+		UHoudiniEditableGeometry::GetUploadLayoutKey(TConstArrayView<const UHoudiniEditableGeometry*>((const UHoudiniEditableGeometry**)HMCs.GetData(), HMCs.Num()))));
 
 	float* PositionDataPtr = SHM;
 	int32* VertexDataPtr = (int32*)(PositionDataPtr + NumPoints * 3);
@@ -865,6 +1076,15 @@ bool UHoudiniMeshComponent::HapiUpload(const TArray<UHoudiniMeshComponent*>& HMC
 	NumPrims = 0;  // Here represent the previous count, and the start index
 	for (const UHoudiniMeshComponent* HMC : HMCs)
 	{
+		if (bLayoutUnchanged && !HMC->NeedUpload())
+		{
+			PositionDataPtr += HMC->Positions.Num() * 3;
+			VertexDataPtr += HMC->NumVertices() + HMC->Polys.Num();
+			NumPoints += HMC->Positions.Num();
+			NumPrims += HMC->Polys.Num();
+			continue;
+		}
+
 		for (FVector3f Position : HMC->Positions)
 		{
 			Position *= POSITION_SCALE_TO_HOUDINI_F;
@@ -906,7 +1126,7 @@ bool UHoudiniMeshComponent::HapiUpload(const TArray<UHoudiniMeshComponent*>& HMC
 
 	// We should empty delta info, to mark this EditGeo unchanged
 	for (UHoudiniMeshComponent* HMC : HMCs)
-		HMC->ResetDeltaInfo();
+		HMC->MarkUploaded();
 
 	return SHMGeoInput.HapiUpload(SHMInputNodeId, SHM);
 }
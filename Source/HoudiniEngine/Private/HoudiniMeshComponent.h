@@ -101,6 +101,19 @@ protected:
 	UPROPERTY()
 	TArray<FIntVector2> Edges;
 
+	// -------- Derived Tangents, transient, used when tangentu or tangentv is missing --------
+	mutable EHoudiniAttributeOwner DerivedTangentOwner = EHoudiniAttributeOwner::Invalid;  // Point or Vertex
+
+	mutable TArray<FVector3f> DerivedTangentUData;
+
+	mutable TArray<FVector3f> DerivedTangentVData;
+
+	mutable bool bDerivedTangentsDirty = true;  // Should be marked when positions, triangles, normals or uvs changed
+
+	FORCEINLINE void MarkDerivedTangentsDirty() { bDerivedTangentsDirty = true; }
+
+	void UpdateDerivedTangents() const;  // UV-aware and parallel, only recompute when dirty
+
 	void GetPointsBounds(const TArray<int32>& PointIndices,  // PointIndices.Num() must >= 1
 		FVector& OutMin, FVector& OutMax) const;
 
@@ -113,7 +126,7 @@ public:
 
 	void ResetMeshData();
 
-	FORCEINLINE int32 AddPoint(const FVector3f& Position) { return Positions.Add(Position); }
+	FORCEINLINE int32 AddPoint(const FVector3f& Position) { MarkDerivedTangentsDirty(); return Positions.Add(Position); }
 
 	void AddTriangle(const FIntVector3& Triangle, const int32& SectionIdx);
 
@@ -165,6 +178,7 @@ public:
 	virtual void PostEditUndo() override
 	{
 		Super::PostEditUndo();
+		MarkDerivedTangentsDirty();
 		TriggerParentNodeToCook();
 	}
 #endif
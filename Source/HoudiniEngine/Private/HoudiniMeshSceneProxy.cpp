@@ -5,6 +5,7 @@
 #include "Materials/MaterialRenderProxy.h"
 #include "MaterialDomain.h"
 #include "DynamicMeshBuilder.h"
+#include "Async/ParallelFor.h"
 
 #include "HoudiniMeshComponent.h"
 
@@ -110,6 +111,8 @@ FHoudiniMeshSceneProxy::~FHoudiniMeshSceneProxy()
 	MeshComponent = nullptr;
 }
 
+#define HOUDINI_MESH_PROXY_BUILD_BATCH_SIZE 1024
+
 #define GET_MESH_ATTRIB_DATA(OWNER, ATTRIB_DATA) switch (OWNER) \
 	{ \
 	case EHoudiniAttributeOwner::Vertex: return (ATTRIB_DATA)[VtxIdx]; \
@@ -128,36 +131,17 @@ void FHoudiniMeshSceneProxy::Build()
 			GET_MESH_ATTRIB_DATA(NormalOwner, NormalData);
 		}
 
-		void TryComputeTangent(EHoudiniAttributeOwner& DerivedTangentUOwner, TArray<FVector3f>& DerivedTangentUData,
-			EHoudiniAttributeOwner& DerivedTangentVOwner, TArray<FVector3f>& DerivedTangentVData)
-		{
-			if (TangentUData.IsEmpty() || TangentVData.IsEmpty())  // We should compute both tangentu and tangentv
-			{
-				DerivedTangentUOwner = NormalOwner;
-				DerivedTangentVOwner = NormalOwner;
-				const int32 NumNormalData = NormalData.Num();
-				DerivedTangentUData.SetNumUninitialized(NumNormalData);
-				DerivedTangentVData.SetNumUninitialized(NumNormalData);
-				for (int32 DataIdx = 0; DataIdx < NumNormalData; ++DataIdx)
-				{
-					NormalData[DataIdx].FindBestAxisVectors(DerivedTangentUData[DataIdx], DerivedTangentUData[DataIdx]);
-				}
-			}
-
-			// TODO: shall we support calculate tangentv data only
-		}
+		FORCEINLINE void UpdateTangents() const { UpdateDerivedTangents(); }
 
-		const FVector3f& GetTangentU(const int32& VtxIdx, const int32& PtIdx, const int32& TriIdx,
-			const EHoudiniAttributeOwner& DerivedTangentUOwner, const TArray<FVector3f>& DerivedTangentUData) const
+		const FVector3f& GetTangentU(const int32& VtxIdx, const int32& PtIdx, const int32& TriIdx) const
 		{
-			GET_MESH_ATTRIB_DATA(DerivedTangentUData.IsEmpty() ? TangentUOwner : DerivedTangentUOwner,
+			GET_MESH_ATTRIB_DATA(DerivedTangentUData.IsEmpty() ? TangentUOwner : DerivedTangentOwner,
 				DerivedTangentUData.IsEmpty() ? TangentUData : DerivedTangentUData);
 		}
 
-		const FVector3f& GetTangentV(const int32& VtxIdx, const int32& PtIdx, const int32& TriIdx,
-			const EHoudiniAttributeOwner& DerivedTangentVOwner, const TArray<FVector3f>& DerivedTangentVData) const
+		const FVector3f& GetTangentV(const int32& VtxIdx, const int32& PtIdx, const int32& TriIdx) const
 		{
-			GET_MESH_ATTRIB_DATA(DerivedTangentVData.IsEmpty() ? TangentVOwner : DerivedTangentVOwner,
+			GET_MESH_ATTRIB_DATA(DerivedTangentVData.IsEmpty() ? TangentVOwner : DerivedTangentOwner,
 				DerivedTangentVData.IsEmpty() ? TangentVData : DerivedTangentVData);
 		}
 
@@ -177,62 +161,154 @@ void FHoudiniMeshSceneProxy::Build()
 			GET_MESH_ATTRIB_DATA(ColorOwner, ColorData);
 		}
 
+		bool CanWeldPoints() const  // Whether all vertex data only depends on point
+		{
+			auto IsPerPointLambda = [](const EHoudiniAttributeOwner& Owner)
+				{
+					return (Owner == EHoudiniAttributeOwner::Point) || (Owner == EHoudiniAttributeOwner::Detail);
+				};
+
+			if (!IsPerPointLambda(NormalOwner) || (!DerivedTangentUData.IsEmpty() && !IsPerPointLambda(DerivedTangentOwner)))
+				return false;
+			if (DerivedTangentUData.IsEmpty() && !TangentUData.IsEmpty() && !IsPerPointLambda(TangentUOwner))
+				return false;
+			if (DerivedTangentVData.IsEmpty() && !TangentVData.IsEmpty() && !IsPerPointLambda(TangentVOwner))
+				return false;
+			if (!ColorData.IsEmpty() && !IsPerPointLambda(ColorOwner))
+				return false;
+			for (const FHoudiniMeshUV& UV : UVs)
+			{
+				if (!IsPerPointLambda(UV.Owner))
+					return false;
+			}
+
+			return true;
+		}
+
 		FORCEINLINE const TArray<FHoudiniMeshSection>& GetSections() const { return Sections; }
 		FORCEINLINE int32 GetNumUVs() const { return UVs.Num(); }
 	};
 
 
-	EHoudiniAttributeOwner DerivedTangentUOwner;
-	TArray<FVector3f> DerivedTangentUData;
-	EHoudiniAttributeOwner DerivedTangentVOwner;
-	TArray<FVector3f> DerivedTangentVData;
-	((FHoudiniMeshDataAccessor*)MeshComponent)->TryComputeTangent(DerivedTangentUOwner, DerivedTangentUData,
-		DerivedTangentVOwner, DerivedTangentVData);
+	const FHoudiniMeshDataAccessor* MeshData = (FHoudiniMeshDataAccessor*)MeshComponent;
+
+	MeshData->UpdateTangents();  // Cached on component, only recompute when positions, normals or uvs changed
 
 	const TArray<FVector3f>& Positions = MeshComponent->GetPositions();
 	const TArray<FIntVector>& Triangles = MeshComponent->GetTriangles();
-	const int32 NumUVs = ((FHoudiniMeshDataAccessor*)MeshComponent)->GetNumUVs();
-	for (const FHoudiniMeshSection& Section : ((FHoudiniMeshDataAccessor*)MeshComponent)->GetSections())
-	{
-		FHoudiniMeshRenderBufferSet* BufferSet = new FHoudiniMeshRenderBufferSet(GetScene().GetFeatureLevel());
-		
-		const int32& NumVertices = Section.TriangleIndices.Num() * 3;
-		BufferSet->StaticMeshVertexBuffer.Init(NumVertices, FMath::Max(NumUVs, 1));  // must have at least one tex coord
-		BufferSet->ColorVertexBuffer.Init(NumVertices);
-		BufferSet->PositionVertexBuffer.Init(NumVertices);
-		BufferSet->IndexBuffer.Indices.SetNumUninitialized(NumVertices);
+	const int32 NumUVs = MeshData->GetNumUVs();
+	const TArray<FHoudiniMeshSection>& Sections = MeshData->GetSections();
+
+	// If all vertex data are per point, then triangles could share vertices by points, rather than de-indexed
+	const bool bWeldPoints = MeshData->CanWeldPoints();
 
-		for (int32 SecTriIdx = 0; SecTriIdx < Section.TriangleIndices.Num(); ++SecTriIdx)
+	auto InitBufferSetLambda = [NumUVs](FHoudiniMeshRenderBufferSet* BufferSet, const int32& NumVertices)
 		{
-			const int32 TriIdx = Section.TriangleIndices[SecTriIdx];
-			const FIntVector& Triangle = Triangles[TriIdx];
-			for (int32 TriVtxIdx = 0; TriVtxIdx < 3; ++TriVtxIdx)
+			BufferSet->StaticMeshVertexBuffer.Init(NumVertices, FMath::Max(NumUVs, 1));  // must have at least one tex coord
+			BufferSet->ColorVertexBuffer.Init(NumVertices);
+			BufferSet->PositionVertexBuffer.Init(NumVertices);
+		};
+
+	auto SetVertexLambda = [&](FHoudiniMeshRenderBufferSet* BufferSet, const int32& SecVtxIdx, const int32& VtxIdx, const int32& PtIdx, const int32& TriIdx)
+		{
+			BufferSet->PositionVertexBuffer.VertexPosition(SecVtxIdx) = Positions[PtIdx];
+			BufferSet->StaticMeshVertexBuffer.SetVertexTangents(SecVtxIdx,
+				MeshData->GetTangentU(VtxIdx, PtIdx, TriIdx),
+				MeshData->GetTangentV(VtxIdx, PtIdx, TriIdx),
+				MeshData->GetNormal(VtxIdx, PtIdx, TriIdx));
+			if (NumUVs >= 1)
+			{
+				for (int32 UVIdx = 0; UVIdx < NumUVs; ++UVIdx)
+					BufferSet->StaticMeshVertexBuffer.SetVertexUV(SecVtxIdx, UVIdx, MeshData->GetUV(VtxIdx, PtIdx, TriIdx, UVIdx));
+			}
+			else
+				BufferSet->StaticMeshVertexBuffer.SetVertexUV(SecVtxIdx, 0, FVector2f::ZeroVector);
+
+			BufferSet->ColorVertexBuffer.VertexColor(SecVtxIdx) = MeshData->GetColor(VtxIdx, PtIdx, TriIdx);
+		};
+
+	// Create buffer sets here, then fill them by sections and chunks of triangles in parallel
+	const int32 StartBufferSetIdx = RenderBufferSets.Num();
+	for (int32 SecIdx = 0; SecIdx < Sections.Num(); ++SecIdx)
+		RenderBufferSets.Add(new FHoudiniMeshRenderBufferSet(GetScene().GetFeatureLevel()));
+
+	ParallelFor(Sections.Num(), [&](int32 SecIdx)
+		{
+			const FHoudiniMeshSection& Section = Sections[SecIdx];
+			FHoudiniMeshRenderBufferSet* BufferSet = RenderBufferSets[StartBufferSetIdx + SecIdx];
+			const int32 NumSecTris = Section.TriangleIndices.Num();
+			TArray<uint32>& Indices = BufferSet->IndexBuffer.Indices;
+			Indices.SetNumUninitialized(NumSecTris * 3);
+
+			if (bWeldPoints)
 			{
-				const int32& PtIdx = Triangle[TriVtxIdx];
-				const int32 VtxIdx = TriIdx * 3 + 2 - TriVtxIdx;
-				const int32 SecVtxIdx = SecTriIdx * 3 + 2 - TriVtxIdx;
-
-				BufferSet->PositionVertexBuffer.VertexPosition(SecVtxIdx) = Positions[PtIdx];
-				BufferSet->StaticMeshVertexBuffer.SetVertexTangents(SecVtxIdx,
-					((FHoudiniMeshDataAccessor*)MeshComponent)->GetTangentU(VtxIdx, PtIdx, TriIdx, DerivedTangentUOwner, DerivedTangentUData),
-					((FHoudiniMeshDataAccessor*)MeshComponent)->GetTangentV(VtxIdx, PtIdx, TriIdx, DerivedTangentVOwner, DerivedTangentVData),
-					((FHoudiniMeshDataAccessor*)MeshComponent)->GetNormal(VtxIdx, PtIdx, TriIdx));
-				if (NumUVs >= 1)
+				// Only remap the point range referenced by this section, to avoid allocating all points for each section
+				int32 MinPtIdx = MAX_int32;
+				int32 MaxPtIdx = INDEX_NONE;
+				for (const int32& TriIdx : Section.TriangleIndices)
 				{
-					for (int32 UVIdx = 0; UVIdx < NumUVs; ++UVIdx)
-						BufferSet->StaticMeshVertexBuffer.SetVertexUV(SecVtxIdx, UVIdx,
-							((FHoudiniMeshDataAccessor*)MeshComponent)->GetUV(VtxIdx, PtIdx, TriIdx, UVIdx));
+					const FIntVector& Triangle = Triangles[TriIdx];
+					MinPtIdx = FMath::Min3(MinPtIdx, Triangle.X, FMath::Min(Triangle.Y, Triangle.Z));
+					MaxPtIdx = FMath::Max3(MaxPtIdx, Triangle.X, FMath::Max(Triangle.Y, Triangle.Z));
 				}
+
+				// If the points of this section are scattered among the whole mesh, then use a map instead
+				const bool bRemapByRange = (NumSecTris >= 1) && ((MaxPtIdx - MinPtIdx + 1) <= NumSecTris * 6);
+				TArray<int32> PointVertexIndices;
+				TMap<int32, int32> PointVertexIndexMap;
+				if (bRemapByRange)
+					PointVertexIndices.Init(INDEX_NONE, MaxPtIdx - MinPtIdx + 1);
 				else
-					BufferSet->StaticMeshVertexBuffer.SetVertexUV(SecVtxIdx, 0, FVector2f::ZeroVector);
-					
-				BufferSet->ColorVertexBuffer.VertexColor(SecVtxIdx) = ((FHoudiniMeshDataAccessor*)MeshComponent)->GetColor(VtxIdx, PtIdx, TriIdx);
-				BufferSet->IndexBuffer.Indices[SecVtxIdx] = SecTriIdx * 3 + TriVtxIdx;
-			}
-		}
+					PointVertexIndexMap.Reserve(NumSecTris);
 
-		RenderBufferSets.Add(BufferSet);
+				// Each point referenced by this section becomes a single vertex, in the order of first reference
+				TArray<int32> VertexPointIndices;
+				for (int32 SecTriIdx = 0; SecTriIdx < NumSecTris; ++SecTriIdx)
+				{
+					const FIntVector& Triangle = Triangles[Section.TriangleIndices[SecTriIdx]];
+					for (int32 TriVtxIdx = 0; TriVtxIdx < 3; ++TriVtxIdx)
+					{
+						int32& SecVtxIdx = bRemapByRange ? PointVertexIndices[Triangle[TriVtxIdx] - MinPtIdx] :
+							PointVertexIndexMap.FindOrAdd(Triangle[TriVtxIdx], INDEX_NONE);
+						if (SecVtxIdx == INDEX_NONE)
+							SecVtxIdx = VertexPointIndices.Add(Triangle[TriVtxIdx]);
+						Indices[SecTriIdx * 3 + TriVtxIdx] = SecVtxIdx;
+					}
+				}
 
+				const int32 NumVertices = VertexPointIndices.Num();
+				InitBufferSetLambda(BufferSet, NumVertices);
+				ParallelFor(FMath::DivideAndRoundUp(NumVertices, HOUDINI_MESH_PROXY_BUILD_BATCH_SIZE), [&](int32 BatchIdx)
+					{
+						const int32 EndSecVtxIdx = FMath::Min((BatchIdx + 1) * HOUDINI_MESH_PROXY_BUILD_BATCH_SIZE, NumVertices);
+						for (int32 SecVtxIdx = BatchIdx * HOUDINI_MESH_PROXY_BUILD_BATCH_SIZE; SecVtxIdx < EndSecVtxIdx; ++SecVtxIdx)
+							SetVertexLambda(BufferSet, SecVtxIdx, 0, VertexPointIndices[SecVtxIdx], 0);  // Vertex and triangle indices are useless for per point data
+					});
+			}
+			else
+			{
+				InitBufferSetLambda(BufferSet, NumSecTris * 3);
+				ParallelFor(FMath::DivideAndRoundUp(NumSecTris, HOUDINI_MESH_PROXY_BUILD_BATCH_SIZE), [&](int32 BatchIdx)
+					{
+						const int32 EndSecTriIdx = FMath::Min((BatchIdx + 1) * HOUDINI_MESH_PROXY_BUILD_BATCH_SIZE, NumSecTris);
+						for (int32 SecTriIdx = BatchIdx * HOUDINI_MESH_PROXY_BUILD_BATCH_SIZE; SecTriIdx < EndSecTriIdx; ++SecTriIdx)
+						{
+							const int32 TriIdx = Section.TriangleIndices[SecTriIdx];
+							const FIntVector& Triangle = Triangles[TriIdx];
+							for (int32 TriVtxIdx = 0; TriVtxIdx < 3; ++TriVtxIdx)
+							{
+								const int32 SecVtxIdx = SecTriIdx * 3 + 2 - TriVtxIdx;
+								SetVertexLambda(BufferSet, SecVtxIdx, TriIdx * 3 + 2 - TriVtxIdx, Triangle[TriVtxIdx], TriIdx);
+								Indices[SecVtxIdx] = SecTriIdx * 3 + TriVtxIdx;
+							}
+						}
+					});
+			}
+		});
+
+	for (int32 BufferSetIdx = StartBufferSetIdx; BufferSetIdx < RenderBufferSets.Num(); ++BufferSetIdx)
+	{
+		FHoudiniMeshRenderBufferSet* BufferSet = RenderBufferSets[BufferSetIdx];
 		ENQUEUE_RENDER_COMMAND(FHoudiniMeshSceneProxyInitialize)(
 			[BufferSet](FRHICommandListImmediate& RHICmdList)
 			{
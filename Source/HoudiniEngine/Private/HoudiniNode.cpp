@@ -127,6 +127,7 @@ void AHoudiniNode::Invalidate()
 
 	NodeId = -1;
 	GeoNodeId = -1;
+	ParmTemplateHash = 0;
 	InvalidateEditableGeometryFeedback();
 
 	for (UHoudiniInput* Input : Inputs)
@@ -153,6 +154,57 @@ bool AHoudiniNode::NeedInstantiate()
 	return false;
 }
 
+uint32 AHoudiniNode::ComputeCookKey() const
+{
+	uint32 CookKey = HashCombine(Asset->GetContentHash(), GetTypeHash(SelectedOpName));
+
+	TMap<FName, FHoudiniGenericParameter> GenericParms;
+	GetGenericParameters(GenericParms);
+	for (const auto& GenericParm : GenericParms)
+	{
+		const FHoudiniGenericParameter& Parm = GenericParm.Value;
+		CookKey = HashCombine(CookKey, GetTypeHash(GenericParm.Key.ToString()));
+		CookKey = HashCombine(CookKey, GetTypeHash((int32(Parm.Type) << 16) | Parm.Size));
+		CookKey = HashCombine(CookKey, FCrc::MemCrc32(&Parm.NumericValues, sizeof(FVector4f)));
+		CookKey = HashCombine(CookKey, GetTypeHash(Parm.StringValue));
+		CookKey = HashCombine(CookKey, GetTypeHash(Parm.ObjectValue.ToSoftObjectPath().ToString()));
+	}
+
+	for (const UHoudiniInput* Input : Inputs)
+	{
+		CookKey = HashCombine(CookKey, GetTypeHash(Input->GetInputName()));
+
+		FString SettingsStr;
+		FHoudiniInputSettings::StaticStruct()->ExportText(SettingsStr, &Input->GetSettings(), nullptr, nullptr, PPF_None, nullptr);
+		CookKey = HashCombine(CookKey, GetTypeHash(SettingsStr));
+
+		for (const UHoudiniInputHolder* Holder : Input->Holders)
+		{
+			if (!IsValid(Holder))  // Content input may have empty slots
+				continue;
+
+			const uint32 HolderHash = Holder->GetContentHash();
+			if (HolderHash == 0)  // Could NOT identify this input, so we must cook
+				return 0;
+
+			CookKey = HashCombine(CookKey, HolderHash);
+		}
+	}
+
+	return (CookKey == 0) ? 1 : CookKey;  // 0 is reserved for "NOT reusable"
+}
+
+bool AHoudiniNode::CanReuseOutputs() const
+{
+	if (!bReuseOutputsOnLoad || !GetDefault<UHoudiniEngineSettings>()->bCookCache || (RequestCookMethod == EHoudiniNodeRequestCookMethod::Force))
+		return false;
+
+	if ((LastCookKey == 0) || HasTopNodePendingCook())
+		return false;
+
+	return ComputeCookKey() == LastCookKey;
+}
+
 bool AHoudiniNode::HapiCookUpstream(bool& bOutHasUpstreamCooking) const
 {
 	bOutHasUpstreamCooking = false;
@@ -169,6 +221,12 @@ bool AHoudiniNode::HapiCookUpstream(bool& bOutHasUpstreamCooking) const
 				if (!IsValid(UpstreamNode))
 					continue;
 
+				if (FHoudiniEngine::Get().IsNodeWorking(UpstreamNode))  // Upstream is cooking concurrently, tick will retry after it finished
+				{
+					bOutHasUpstreamCooking = true;
+					return true;
+				}
+
 				if (UpstreamNode->NeedCook() || UpstreamNode->NodeId < 0)  // Upstream haven't been instantiated yet
 				{
 					bOutHasUpstreamCooking = true;
@@ -181,6 +239,67 @@ bool AHoudiniNode::HapiCookUpstream(bool& bOutHasUpstreamCooking) const
 	return true;
 }
 
+int32 AHoudiniNode::FindUpstreamSessionIndex() const
+{
+	for (const UHoudiniInput* Input : Inputs)
+	{
+		if (Input->GetType() != EHoudiniInputType::Node)
+			continue;
+
+		for (const UHoudiniInputHolder* Holder : Input->Holders)
+		{
+			if (const UHoudiniInputNode* InputNode = Cast<UHoudiniInputNode>(Holder))
+			{
+				const AHoudiniNode* UpstreamNode = InputNode->GetNode();
+				if (IsValid(UpstreamNode) && (UpstreamNode->NodeId >= 0))
+					return UpstreamNode->SessionIdx;
+			}
+		}
+	}
+
+	return -1;
+}
+
+bool AHoudiniNode::HapiBindSession()
+{
+	const int32 UpstreamSessionIdx = FindUpstreamSessionIndex();
+	if (NodeId < 0)  // Node inputs could only merge nodes in the same session, otherwise, choose the most idle one
+	{
+		SessionIdx = (UpstreamSessionIdx >= 0) ? UpstreamSessionIdx : FHoudiniEngine::Get().AcquireSessionIndex();
+		return true;
+	}
+
+	if ((UpstreamSessionIdx < 0) || (UpstreamSessionIdx == SessionIdx))
+		return true;
+
+	// Upstream is in another session, so we should destroy this node in current session, and rebuild it in upstream's session
+	const FHoudiniSessionScope SessionScope(SessionIdx);
+
+	Asset->UnregisterInstantiatedNode(this);
+
+	HAPI_SESSION_FAIL_RETURN(FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), GeoNodeId >= 0 ? GeoNodeId : NodeId));
+
+	for (UHoudiniInput* Input : Inputs)
+	{
+		for (UHoudiniInputHolder* Holder : Input->Holders)  // Destroy holder nodes in the previous session, and reset their node ids and shm handles
+		{
+			if (IsValid(Holder))
+				HOUDINI_FAIL_RETURN(Holder->HapiDestroy());
+		}
+
+		if (Input->GetGeoNodeId() >= 0)
+			HAPI_SESSION_FAIL_RETURN(FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), Input->GetGeoNodeId()));
+	}
+
+	const EHoudiniNodeRequestCookMethod CurrRequestCookMethod = RequestCookMethod;
+	Invalidate();  // Will also mark bRebuildBeforeCook
+	RequestCookMethod = CurrRequestCookMethod;
+
+	SessionIdx = UpstreamSessionIdx;
+
+	return true;
+}
+
 bool AHoudiniNode::HapiAsyncProcess(const bool& bAfterInstantiating)
 {
 	if (!IsValid(Asset))  // Check if HDA is valid or deleted manually
@@ -196,20 +315,34 @@ bool AHoudiniNode::HapiAsyncProcess(const bool& bAfterInstantiating)
 		if (bHasUpstreamCooking)
 			return true;
 
+		HOUDINI_FAIL_RETURN(HapiBindSession());
+	}
+
+	const FHoudiniSessionScope SessionScope(this);  // All HAPI calls below should in the session this node bound to
+
+	if (!bAfterInstantiating)
+	{
 		BroadcastEvent(EHoudiniNodeEvent::StartCook);
 
+		CookTime = 0.0;
+		OutputTime = 0.0;
+
 		if (NeedInstantiate())  // Instantiate
 		{
-			FHoudiniEngine::Get().StartHoudiniTask();
+			FHoudiniEngine::Get().StartHoudiniTask(this);
 			FHoudiniEngine::Get().HoudiniAsyncTaskMessageEvent.Broadcast(FText::FromString(GetActorLabel(false) + ": Start Instantiate"));
 			UE::Tasks::Launch(UE_SOURCE_LOCATION, [this]
 				{
+					const FHoudiniSessionScope SessionScope(this);
+
 					HOUDINI_FAIL_INVALIDATE_RETURN(this->HapiInstantiate());  // INSTANTIATE !!!
 
 					AsyncTask(ENamedThreads::GameThread, [this]
 						{
+							const FHoudiniSessionScope SessionScope(this);
+
 							FHoudiniEngine::Get().FinishHoudiniAsyncTaskMessage();
-							FHoudiniEngine::Get().FinishHoudiniTask();
+							FHoudiniEngine::Get().FinishHoudiniTask(this);
 
 							if (this->GetNodeId() < 0)  // Failed to instantiate
 								return;
@@ -248,11 +381,23 @@ bool AHoudiniNode::HapiAsyncProcess(const bool& bAfterInstantiating)
 	HOUDINI_FAIL_RETURN(this->HapiUploadEditableOutputs());
 	if (bCookOnParameterChanged || (RequestCookMethod == EHoudiniNodeRequestCookMethod::Force))
 	{
-		FHoudiniEngine::Get().StartHoudiniTask();
+		const bool bReuseOutputs = CanReuseOutputs();
+		bReuseOutputsOnLoad = false;  // Only the first cook after loading could be skipped
+		if (bReuseOutputs)  // Nothing changed since the saved outputs cooked, level just reopened
+		{
+			UE_LOG(LogHoudiniEngine, Log, TEXT("%s: Cook skipped, outputs are identical to the last cook"), *GetActorLabel(false));
+			FinishCook(false);  // Outputs NOT changed, so we need NOT to notify downstream nodes
+			return true;
+		}
+
+		FHoudiniEngine::Get().RecordCookStart();
+		FHoudiniEngine::Get().StartHoudiniTask(this);
 		FHoudiniEngine::Get().HoudiniAsyncTaskMessageEvent.Broadcast(FText::FromString(GetActorLabel(false) + TEXT(": Start Cook")));
 		FHoudiniEngine::Get().LimitEngineFrameRate();
 		UE::Tasks::Launch(UE_SOURCE_LOCATION, [this]
 			{
+				const FHoudiniSessionScope SessionScope(this);
+
 				TArray<FString> GeoNames;
 				TArray<HAPI_GeoInfo> GeoInfos;
 				TArray<TArray<HAPI_PartInfo>> GeoPartInfos;
@@ -260,8 +405,9 @@ bool AHoudiniNode::HapiAsyncProcess(const bool& bAfterInstantiating)
 
 				AsyncTask(ENamedThreads::GameThread, [this, GeoNames, GeoInfos, GeoPartInfos]
 					{
-						FHoudiniEngine::Get().RecoverEngineFrameRate();
-						FHoudiniEngine::Get().FinishHoudiniTask();
+						const FHoudiniSessionScope SessionScope(this);
+
+						FHoudiniEngine::Get().FinishHoudiniTask(this);  // Will also recover engine frame rate if no other node cooking
 
 						HOUDINI_FAIL_INVALIDATE_RETURN(this->HapiUpdateParameters(false));  // Only update parms and values, do NOT update defaults and tags
 						bool bHasNewInputsPendingUpload = false;
@@ -272,11 +418,13 @@ bool AHoudiniNode::HapiAsyncProcess(const bool& bAfterInstantiating)
 							HOUDINI_FAIL_INVALIDATE_RETURN(this->HapiUploadInputsAndParameters());
 							HOUDINI_FAIL_INVALIDATE_RETURN(this->HapiUploadEditableOutputs());  // TODO: we really need this?
 
-							FHoudiniEngine::Get().StartHoudiniTask();
+							FHoudiniEngine::Get().StartHoudiniTask(this);
 							FHoudiniEngine::Get().HoudiniAsyncTaskMessageEvent.Broadcast(FText::FromString(GetActorLabel(false) + ": Start Cook"));
 
 							UE::Tasks::Launch(UE_SOURCE_LOCATION, [this]
 								{
+									const FHoudiniSessionScope SessionScope(this);
+
 									TArray<FString> GeoNames;
 									TArray<HAPI_GeoInfo> GeoInfos;
 									TArray<TArray<HAPI_PartInfo>> GeoPartInfos;
@@ -284,33 +432,21 @@ bool AHoudiniNode::HapiAsyncProcess(const bool& bAfterInstantiating)
 
 									AsyncTask(ENamedThreads::GameThread, [this, GeoNames, GeoInfos, GeoPartInfos]
 										{
-											FHoudiniEngine::Get().FinishHoudiniTask();
+											const FHoudiniSessionScope SessionScope(this);
+
+											FHoudiniEngine::Get().FinishHoudiniTask(this);
 
 											HOUDINI_FAIL_INVALIDATE_RETURN(this->HapiUpdateParameters(false));  // Only update parms and values, do NOT update defaults and tags
 											bool bHasNewInputsPendingUpload = false;  // We should not parse it again
 											HOUDINI_FAIL_INVALIDATE_RETURN(this->HapiUpdateInputs(false, bHasNewInputsPendingUpload));  // Update operator path inputs by parm value then name
 
-											HOUDINI_FAIL_INVALIDATE_RETURN(this->HapiUpdateOutputs(GeoNames, GeoInfos, GeoPartInfos));
-											
-											if (this->HasTopNodePendingCook())
-												this->AsyncCookPDG();
-											else
-												FHoudiniEngine::Get().FinishHoudiniAsyncTaskMessage();
-
-											this->FinishCook();
+											HOUDINI_FAIL_INVALIDATE_RETURN(this->HapiPostCook(GeoNames, GeoInfos, GeoPartInfos));
 										});
 								});
 						}
 						else
 						{
-							HOUDINI_FAIL_INVALIDATE_RETURN(this->HapiUpdateOutputs(GeoNames, GeoInfos, GeoPartInfos));
-							
-							if (this->HasTopNodePendingCook())
-								this->AsyncCookPDG();
-							else
-								FHoudiniEngine::Get().FinishHoudiniAsyncTaskMessage();
-
-							this->FinishCook();
+							HOUDINI_FAIL_INVALIDATE_RETURN(this->HapiPostCook(GeoNames, GeoInfos, GeoPartInfos));
 						}
 					});
 			});
@@ -398,7 +534,25 @@ void AHoudiniNode::CleanupSplitActors()
 	}
 }
 
-void AHoudiniNode::FinishCook()
+bool AHoudiniNode::HapiPostCook(const TArray<FString>& GeoNames, const TArray<HAPI_GeoInfo>& GeoInfos, const TArray<TArray<HAPI_PartInfo>>& GeoPartInfos)
+{
+	LastCookKey = 0;  // Outputs are being modified, so should NOT be reused if failed
+	HOUDINI_FAIL_RETURN(HapiUpdateOutputs(GeoNames, GeoInfos, GeoPartInfos));
+	LastCookKey = ComputeCookKey();
+
+	if (HasTopNodePendingCook())
+		AsyncCookPDG();
+	else
+		FHoudiniEngine::Get().FinishHoudiniAsyncTaskMessage();
+
+	FinishCook();
+
+	FHoudiniEngine::Get().RecordCookFinish(CookTime, OutputTime);
+
+	return true;
+}
+
+void AHoudiniNode::FinishCook(const bool& bNotifyDownstream)
 {
 	bRebuildBeforeCook = false;
 	RequestCookMethod = EHoudiniNodeRequestCookMethod::None;
@@ -408,7 +562,8 @@ void AHoudiniNode::FinishCook()
 
 	BroadcastEvent(EHoudiniNodeEvent::FinishCook);
 
-	NotifyDownstreamCookFinish();
+	if (bNotifyDownstream)
+		NotifyDownstreamCookFinish();
 
 	DeltaInfo.Empty();
 }
@@ -427,6 +582,8 @@ bool AHoudiniNode::HapiDestroy()
 	
 	Asset->UnregisterInstantiatedNode(this);
 
+	const FHoudiniSessionScope SessionScope(this);
+
 	// Destroy all nodes in houdini session
 	HAPI_SESSION_FAIL_RETURN(FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), GeoNodeId >= 0 ? GeoNodeId : NodeId));
 
@@ -447,6 +604,8 @@ void AHoudiniNode::PostLoad()
 {
 	Super::PostLoad();
 
+	bReuseOutputsOnLoad = true;
+
 	FHoudiniEngine::Get().RegisterNode(this);
 }
 
@@ -580,6 +739,7 @@ bool AHoudiniNode::HapiOnTransformed() const
 	const int32& ObjectNodeId = GeoNodeId >= 0 ? GeoNodeId : NodeId;
 	if (ObjectNodeId >= 0)
 	{
+		const FHoudiniSessionScope SessionScope(this);
 		const HAPI_TransformEuler HapiTransform = FHoudiniEngineUtils::ConvertTransform(NodeTransform);
 		HAPI_SESSION_FAIL_RETURN(FHoudiniApi::SetObjectTransform(FHoudiniEngine::Get().GetSession(),
 			ObjectNodeId, &HapiTransform));
@@ -610,7 +770,7 @@ bool AHoudiniNode::NeedWaitUpstreamCookFinish() const
 			if (!IsValid(UpstreamNode))
 				continue;
 
-			if (UpstreamNode->NeedCook())
+			if (UpstreamNode->NeedCook() || FHoudiniEngine::Get().IsNodeWorking(UpstreamNode))
 				return true;
 
 			if (UpstreamNode->NodeId < 0)  // Upstream haven't been instantiated yet
@@ -635,7 +795,8 @@ void AHoudiniNode::NotifyDownstreamCookFinish()
 				if ((Input->GetType() != EHoudiniInputType::Node) || !Input->Holders.IsValidIndex(0))
 					continue;
 
-				if (GetFName() == Cast<UHoudiniInputNode>(Input->Holders[0])->GetNodeActorName())
+				const UHoudiniInputNode* InputNode = Cast<UHoudiniInputNode>(Input->Holders[0]);
+				if (IsValid(InputNode) && (GetFName() == InputNode->GetNodeActorName()))
 				{
 					if (DownstreamNode->bCookOnUpstreamChanged && Input->GetSettings().bCheckChanged)
 					{
@@ -946,7 +1107,9 @@ bool AHoudiniNode::HapiCook(TArray<FString>& OutGeoNames, TArray<HAPI_GeoInfo>&
 		}
 	}
 	
-	UE_LOG(LogHoudiniEngine, Log, TEXT("%s: COOK %.3f (s)"), *GetActorLabel(false), FPlatformTime::Seconds() - StartTime);
+	const double TimeCost = FPlatformTime::Seconds() - StartTime;
+	CookTime += TimeCost;
+	UE_LOG(LogHoudiniEngine, Log, TEXT("%s: COOK %.3f (s)"), *GetActorLabel(false), TimeCost);
 
 	return true;
 }
@@ -971,6 +1134,8 @@ static bool IsParameterInAttributeSet(const TArray<UHoudiniParameter*>& AttribPa
 
 void AHoudiniNode::TriggerCookByParameter(const UHoudiniParameter* ChangedParm)
 {
+	LastCookKey = 0;  // Saved outputs are out of date
+
 	// First, check is attrib-parm, then update parm-attrib.
 	// Vars for attrib-parm
 	FString AttribGroupName;
@@ -1075,6 +1240,8 @@ void AHoudiniNode::TriggerCookByParameter(const UHoudiniParameter* ChangedParm)
 
 void AHoudiniNode::TriggerCookByInput(const UHoudiniInput* ChangedInput)
 {
+	LastCookKey = 0;  // Saved outputs are out of date, even if we will NOT cook now
+
 	if (!GetDefault<UHoudiniEngineSettings>()->bCookOnInputChanged)
 		return;
 
@@ -1101,6 +1268,8 @@ void AHoudiniNode::AppendDeltaInfos(const FString& NewDeltaInfo, const FString&
 
 void AHoudiniNode::TriggerCookByEditableGeometry(const UHoudiniEditableGeometry* ChangedEditGeo)
 {
+	LastCookKey = 0;  // Editable geometries are NOT part of cook key, so we should always cook after modification
+
 	if (ChangedEditGeo->IsA<UHoudiniCurvesComponent>())  // CurvesComponent maybe as both input/edit curve, so we should try find it in inputs
 	{
 		for (const UHoudiniInput* Input : Inputs)
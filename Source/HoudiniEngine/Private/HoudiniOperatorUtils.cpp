@@ -41,69 +41,213 @@ else\
 return true;
 
 
+// -------- shared memory arena --------
+struct FHoudiniSharedMemoryView
+{
+	FString SHMPath;
+	float* Data = nullptr;
+	size_t Capacity32 = 0;
+	uint32 LayoutKey = 0;  // 0 means the content is unknown
+};
+
+static FCriticalSection GHoudiniSharedMemoryArenaLock;
+static TMap<size_t, FHoudiniSharedMemoryView> GHoudiniSharedMemoryArenaViews;  // Handle -> persistent view
+static TSet<const float*> GHoudiniSharedMemoryArenaData;
+
+size_t FHoudiniSharedMemoryArena::GetSizeClass(const size_t& Size32)
+{
+	if (Size32 <= 262144)  // Below 1MB, just 4kb align
+		return (Size32 % 1024) ? ((Size32 / 1024 + 1) * 1024) : Size32;
+
+	// 8 size classes for each power of 2, so that at most 12.5% memory will be wasted
+	const size_t Step32 = size_t(1) << (FPlatformMath::FloorLog2_64(Size32) - 3);
+	return (Size32 % Step32) ? ((Size32 / Step32 + 1) * Step32) : Size32;
+}
+
+float* FHoudiniSharedMemoryArena::FindOrCreate(const FString& SHMPath, const size_t& Capacity32, size_t& InOutHandle)
+{
+	FScopeLock ScopeLock(&GHoudiniSharedMemoryArenaLock);
+
+	if (InOutHandle)
+	{
+		FHoudiniSharedMemoryView View;
+		if (GHoudiniSharedMemoryArenaViews.RemoveAndCopyValue(InOutHandle, View))
+		{
+			if (View.SHMPath == SHMPath)  // The same segment is still mapped, so we could reuse it directly
+			{
+				GHoudiniSharedMemoryArenaViews.Add(InOutHandle, View);
+				return View.Data;
+			}
+
+			// Size class changed, we should unmap the old view, the old handle will be closed by FindOrCreateSharedMemory
+			GHoudiniSharedMemoryArenaData.Remove(View.Data);
+			FHoudiniEngineUtils::UnmapSharedMemory(View.Data);
+		}
+	}
+
+	bool bFound = false;
+	float* SHM = FHoudiniEngineUtils::FindOrCreateSharedMemory(*SHMPath, Capacity32, InOutHandle, bFound);
+	if (SHM)
+	{
+		GHoudiniSharedMemoryArenaViews.Add(InOutHandle, FHoudiniSharedMemoryView{ SHMPath, SHM, Capacity32 });
+		GHoudiniSharedMemoryArenaData.Add(SHM);
+	}
+
+	return SHM;
+}
+
+void FHoudiniSharedMemoryArena::Unmap(const float* SHM)
+{
+	{
+		FScopeLock ScopeLock(&GHoudiniSharedMemoryArenaLock);
+		if (GHoudiniSharedMemoryArenaData.Contains(SHM))
+			return;
+	}
+
+	FHoudiniEngineUtils::UnmapSharedMemory(SHM);
+}
+
+void FHoudiniSharedMemoryArena::Release(const size_t& Handle)
+{
+	FScopeLock ScopeLock(&GHoudiniSharedMemoryArenaLock);
+
+	FHoudiniSharedMemoryView View;
+	if (GHoudiniSharedMemoryArenaViews.RemoveAndCopyValue(Handle, View))
+	{
+		GHoudiniSharedMemoryArenaData.Remove(View.Data);
+		FHoudiniEngineUtils::UnmapSharedMemory(View.Data);
+	}
+}
+
+bool FHoudiniSharedMemoryArena::UpdateLayoutKey(const size_t& Handle, const uint32& LayoutKey)
+{
+	FScopeLock ScopeLock(&GHoudiniSharedMemoryArenaLock);
+
+	if (FHoudiniSharedMemoryView* FoundView = GHoudiniSharedMemoryArenaViews.Find(Handle))
+	{
+		const bool bUnchanged = (LayoutKey != 0) && (FoundView->LayoutKey == LayoutKey);
+		FoundView->LayoutKey = LayoutKey;
+		return bUnchanged;
+	}
+
+	return false;
+}
+
+
 // -------- sharedmemory_geometryinput --------
 bool FHoudiniSharedMemoryGeometryInput::HapiCreateNode(const int32& ParentNodeId, const FString& NodeLabel, int32& OutNodeId)
 {
 	HAPI_CREATE_SOP_NODE(sharedmemory_geometryinput);
 }
 
-FHoudiniSharedMemoryGeometryInput::FHoudiniSharedMemoryGeometryInput(const int32& InNumPoints, const int32& InNumPrims, const int32& InNumVertices)
+FHoudiniSharedMemoryGeometryInput::FHoudiniSharedMemoryGeometryInput(const int32& InNumPoints, const int32& InNumPrims, const int32& InNumVertices,
+	const bool& bInZeroFillGeometry)
 {
 	NumPoints = InNumPoints;
 	NumPrims = InNumPrims;
+	bZeroFillGeometry = bInZeroFillGeometry;
 	
 	Size32 = NumPoints * 3 + InNumVertices + InNumPrims;  // Each PrimVertexArray will end with a minus number, which abs represent primtype(open/closed)
 }
 
 void FHoudiniSharedMemoryGeometryInput::AppendGroup(const char* GroupName,
-	const EHoudiniAttributeOwner& Class, const size_t& InSize32, const bool& bUniqueValue)
+	const EHoudiniAttributeOwner& Class, const size_t& InSize32, const bool& bUniqueValue, const bool& bZeroFill)
 {
-	Size32 += InSize32;
-
 	FHoudiniSHMAttribInfo InputAttribInfo;
 	InputAttribInfo.Name = GroupName;
 	InputAttribInfo.Owner = Class;
 	InputAttribInfo.Type = EHoudiniInputAttributeStorage::Group;
 	InputAttribInfo.Compression = bUniqueValue ? EHoudiniInputAttributeCompression::UniqueValue : EHoudiniInputAttributeCompression::None;
+	InputAttribInfo.Offset32 = Size32;
+	InputAttribInfo.Size32 = InSize32;
+	InputAttribInfo.bZeroFill = bZeroFill;
 	InputAttribInfos.Add(InputAttribInfo);
+
+	Size32 += InSize32;
 }
 
 void FHoudiniSharedMemoryGeometryInput::AppendAttribute(const char* AttribName,
 	const EHoudiniAttributeOwner& Class, const EHoudiniInputAttributeStorage& Storage, const int32& TupleSize, const size_t& InSize32,
-	const EHoudiniInputAttributeCompression& Compression)
+	const EHoudiniInputAttributeCompression& Compression, const bool& bZeroFill)
 {
-	Size32 += InSize32;
-
 	FHoudiniSHMAttribInfo InputAttribInfo;
 	InputAttribInfo.Name = AttribName;
 	InputAttribInfo.Owner = Class;
 	InputAttribInfo.Type = Storage;
 	InputAttribInfo.TupleSize = TupleSize;
 	InputAttribInfo.Compression = Compression;
+	InputAttribInfo.Offset32 = Size32;
+	InputAttribInfo.Size32 = InSize32;
+	InputAttribInfo.bZeroFill = bZeroFill;
 	InputAttribInfos.Add(InputAttribInfo);
+
+	Size32 += InSize32;
 }
 
 float* FHoudiniSharedMemoryGeometryInput::GetSharedMemory(const FString& SHMIdentifier, size_t& InOutHandle)
 {
+	const size_t DataSize32 = Size32;
+
 	// Force 4kb align
 	if (Size32 % 1024)  // 4kb = 1024 * size(float) bytes
 		Size32 = (Size32 / 1024 + 1) * 1024;
+
+	// Segment is named by its size class rather than Size32, so we could reuse it when the size changes slightly
+	const size_t Capacity32 = FHoudiniSharedMemoryArena::GetSizeClass(Size32);
 #if PLATFORM_WINDOWS
-	SHMPath = FHoudiniEngine::GetProcessIdentifier() + SHMIdentifier + TEXT("_") + FString::FromInt(Size32);
+	SHMPath = FHoudiniEngine::GetProcessIdentifier() + SHMIdentifier + TEXT("_") + FString::FromInt(Capacity32);
 #else
-	SHMPath = FHoudiniEngine::GetProcessIdentifier() + ((SHMIdentifier.Len() <= 16) ? (SHMIdentifier + TEXT("_") + FString::FromInt(Size32)) :
-		FString::Printf(TEXT("%08X_%d"), FCrc::StrCrc32(*SHMIdentifier), Size32));  // macOS does NOT support long file name
+	SHMPath = FHoudiniEngine::GetProcessIdentifier() + ((SHMIdentifier.Len() <= 16) ? (SHMIdentifier + TEXT("_") + FString::FromInt(Capacity32)) :
+		FString::Printf(TEXT("%08X_%d"), FCrc::StrCrc32(*SHMIdentifier), Capacity32));  // macOS does NOT support long file name
 #endif
-	bool bFound = false;
-	float* SHM = FHoudiniEngineUtils::FindOrCreateSharedMemory(*SHMPath, Size32, InOutHandle, bFound);
-	
-	FMemory::Memzero(SHM, Size32 * sizeof(float));
+	float* SHM = FHoudiniSharedMemoryArena::FindOrCreate(SHMPath, Capacity32, InOutHandle);
+	if (!SHM)
+		return nullptr;
+
+	// Only zero the regions that writer will NOT overwrite, and merge the adjacent regions to reduce memset calls
+	size_t ZeroStart32 = 0;
+	size_t ZeroEnd32 = bZeroFillGeometry ? (InputAttribInfos.IsEmpty() ? DataSize32 : InputAttribInfos[0].Offset32) : 0;
+	for (const FHoudiniSHMAttribInfo& AttribInfo : InputAttribInfos)
+	{
+		if (!AttribInfo.bZeroFill || (AttribInfo.Size32 == 0))
+			continue;
+
+		if (AttribInfo.Offset32 != ZeroEnd32)
+		{
+			if (ZeroEnd32 > ZeroStart32)
+				FMemory::Memzero(SHM + ZeroStart32, (ZeroEnd32 - ZeroStart32) * sizeof(float));
+			ZeroStart32 = AttribInfo.Offset32;
+		}
+		ZeroEnd32 = AttribInfo.Offset32 + AttribInfo.Size32;
+	}
+	if (ZeroEnd32 != DataSize32)
+	{
+		if (ZeroEnd32 > ZeroStart32)
+			FMemory::Memzero(SHM + ZeroStart32, (ZeroEnd32 - ZeroStart32) * sizeof(float));
+		ZeroStart32 = DataSize32;
+	}
+	FMemory::Memzero(SHM + ZeroStart32, (Size32 - ZeroStart32) * sizeof(float));  // Also zero the align padding
+
 	return SHM;
 }
 
+uint32 FHoudiniSharedMemoryGeometryInput::GetLayoutHash() const
+{
+	uint32 LayoutHash = HashCombine(HashCombine(GetTypeHash(NumPoints), GetTypeHash(NumPrims)), GetTypeHash(uint64(Size32)));
+	for (const FHoudiniSHMAttribInfo& AttribInfo : InputAttribInfos)
+	{
+		LayoutHash = HashCombine(LayoutHash, FCrc::StrCrc32(AttribInfo.Name.c_str()));
+		LayoutHash = HashCombine(LayoutHash, GetTypeHash((int32(AttribInfo.Owner) << 24) | (int32(AttribInfo.Type) << 16) |
+			(int32(AttribInfo.Compression) << 12) | AttribInfo.TupleSize));
+		LayoutHash = HashCombine(LayoutHash, GetTypeHash(uint64(AttribInfo.Size32)));
+	}
+
+	return LayoutHash;
+}
+
 bool FHoudiniSharedMemoryGeometryInput::HapiUpload(const int32& SHMGeoInputNodeId, const float* SHMToUnmap) const
 {
-	FHoudiniEngineUtils::UnmapSharedMemory(SHMToUnmap);
+	FHoudiniSharedMemoryArena::Unmap(SHMToUnmap);
 	
 	FString ParmStr = FString::Printf(TEXT("{\"shmpath\":\"%s\",\"datasize32\":%d,\"numpts\":%d,\"numprims\":%d,"),
 		*SHMPath, Size32, NumPoints, NumPrims);
@@ -605,6 +749,20 @@ bool FHoudiniSopAttribCreate::HapiSetDeltaInfo(const int32& AttribCreateNodeId,
 }
 
 
+// -------- "object_merge" sop --------
+bool FHoudiniSopObjectMerge::HapiCreateNode(const int32& ParentNodeId, const FString& NodeLabel, int32& OutNodeId)
+{
+	HAPI_CREATE_SOP_NODE(object_merge);
+}
+
+bool FHoudiniSopObjectMerge::HapiSetObjectPath(const int32& ObjectMergeNodeId, const FString& ObjectPath)
+{
+	FHoudiniParameterPresetHelper PresetHelper;
+	PresetHelper.Append("objpath1", "\"" + std::string(TCHAR_TO_UTF8(*ObjectPath)) + "\"");
+	return PresetHelper.HapiSet(ObjectMergeNodeId);
+}
+
+
 // -------- "file" sop --------
 bool FHoudiniSopFile::HapiCreateNode(const int32& ParentNodeId, const FString& NodeLabel, int32& OutNodeId)
 {
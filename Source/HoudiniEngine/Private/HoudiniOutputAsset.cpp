@@ -11,6 +11,17 @@
 #include "HoudiniAttribute.h"
 
 
+bool FHoudiniAssetOutputBuilder::GetClaimRule(FHoudiniOutputClaimRule& OutRule) const
+{
+	OutRule.PartTypeMask = (1u << HAPI_PARTTYPE_MESH);
+	OutRule.GeometryFilter = EHoudiniPartGeometryFilter::Points;
+	OutRule.RequiredAttribs.Add({ HAPI_ATTRIB_UNREAL_OBJECT_PATH, EHoudiniAttributeOwner::Point });
+	OutRule.ExcludedAttribs.Add({ HAPI_ATTRIB_UNREAL_INSTANCE, EHoudiniAttributeOwner::Point });  // Instancer outputs
+	OutRule.ExcludedAttribs.Add({ HAPI_ATTRIB_PARTIAL_OUTPUT_MODE, EHoudiniAttributeOwner::Point });
+	OutRule.bFinal = false;  // Need to check attribute storage
+	return true;
+}
+
 bool FHoudiniAssetOutputBuilder::HapiIsPartValid(const int32& NodeId, const HAPI_PartInfo& PartInfo, bool& bOutIsValid, bool& bOutShouldHoldByOutput)
 {
 	bOutIsValid = false;
@@ -13,6 +13,12 @@
 #include "HoudiniCurvesComponent.h"
 
 
+bool FHoudiniCurveOutputBuilder::GetClaimRule(FHoudiniOutputClaimRule& OutRule) const
+{
+	OutRule.PartTypeMask = (1u << HAPI_PARTTYPE_CURVE);
+	return true;
+}
+
 bool FHoudiniCurveOutputBuilder::HapiIsPartValid(const int32& NodeId, const HAPI_PartInfo& PartInfo, bool& bOutIsValid, bool& bOutShouldHoldByOutput)
 {
 	bOutIsValid = PartInfo.type == HAPI_PARTTYPE_CURVE;
@@ -16,6 +16,15 @@
 #include "HoudiniAttribute.h"
 
 
+bool FHoudiniDataTableOutputBuilder::GetClaimRule(FHoudiniOutputClaimRule& OutRule) const
+{
+	OutRule.PartTypeMask = (1u << HAPI_PARTTYPE_MESH);
+	OutRule.GeometryFilter = EHoudiniPartGeometryFilter::Points;
+	OutRule.RequiredAttribs.Add({ HAPI_ATTRIB_UNREAL_DATA_TABLE_ROWNAME, EHoudiniAttributeOwner::Point });
+	OutRule.bFinal = false;  // Need to check attribute storage
+	return true;
+}
+
 bool FHoudiniDataTableOutputBuilder::HapiIsPartValid(const int32& NodeId, const HAPI_PartInfo& PartInfo, bool& bOutIsValid, bool& bOutShouldHoldByOutput)
 {
 	bOutIsValid = false;
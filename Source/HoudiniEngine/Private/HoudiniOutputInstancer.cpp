@@ -39,6 +39,13 @@
 #endif
 
 
+bool FHoudiniInstancerOutputBuilder::GetClaimRule(FHoudiniOutputClaimRule& OutRule) const
+{
+	OutRule.PartTypeMask = (1u << HAPI_PARTTYPE_INSTANCER) | (1u << HAPI_PARTTYPE_MESH);
+	OutRule.GeometryFilter = EHoudiniPartGeometryFilter::Points;
+	return true;
+}
+
 bool FHoudiniInstancerOutputBuilder::HapiIsPartValid(const int32& NodeId, const HAPI_PartInfo& PartInfo, bool& bOutIsValid, bool& bOutShouldHoldByOutput)
 {
 	bOutIsValid = ((PartInfo.type == HAPI_PARTTYPE_INSTANCER) ||  // Instantiate packed mesh
@@ -723,6 +730,178 @@ FORCEINLINE static TAssetClass* LoadAssetFromHoudiniString(const std::string& St
 	return (IsValid(LoadedAsset) ? LoadedAsset : nullptr);
 }
 
+struct FHoudiniComponentNoCollisionScope
+{
+	UStaticMeshComponent* Component = nullptr;
+	FName CollisionProfileName;
+	ECollisionEnabled::Type CollisionEnabled = ECollisionEnabled::NoCollision;
+	bool bUseDefaultCollision = false;
+
+	FHoudiniComponentNoCollisionScope(UStaticMeshComponent* InComponent)
+	{
+		if (IsValid(InComponent))
+		{
+			Component = InComponent;
+			CollisionEnabled = Component->GetCollisionEnabled();
+			if (CollisionEnabled != ECollisionEnabled::NoCollision)
+			{
+				bUseDefaultCollision = Component->bUseDefaultCollision;
+				CollisionProfileName = Component->GetCollisionProfileName();
+				Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+			}
+		}
+	}
+
+	~FHoudiniComponentNoCollisionScope()
+	{
+		if (IsValid(Component))
+		{
+			if (CollisionEnabled != ECollisionEnabled::NoCollision)
+			{
+				if (CollisionProfileName != UCollisionProfile::CustomCollisionProfileName)
+					Component->SetCollisionProfileName(CollisionProfileName);
+				else
+					Component->SetCollisionEnabled(CollisionEnabled);
+
+				if (bUseDefaultCollision)
+					Component->bUseDefaultCollision = true;
+			}
+		}
+	}
+};
+
+// Match instances by stable ids, then only apply added, removed and changed instances, to avoid rewriting all instances of a large ISMC.
+// Return false if could NOT diff, then we should rewrite all instances
+static bool DiffUpdateInstances(UInstancedStaticMeshComponent* ISMC, TArray<int32>& InOutInstanceIds,
+	const TArray<int32>& NewInstanceIds, const TArray<FTransform>& Transforms, const TArray<int32>& InstPointIndices,
+	const int32 NumCustomFloats, const TArray<float>& InstCustomFloats)
+{
+	const int32 NumOldInsts = ISMC->GetInstanceCount();
+	const int32 NumNewInsts = NewInstanceIds.Num();
+	if ((NumOldInsts <= 0) || (InOutInstanceIds.Num() != NumOldInsts) ||  // Nothing to diff, or ISMC has been modified outside
+		(ISMC->NumCustomDataFloats != NumCustomFloats))  // Custom data layout changed, all custom floats will be reset
+		return false;
+
+	TMap<int32, int32> OldIdSlotMap;  // <Id, OldInstIdx>
+	OldIdSlotMap.Reserve(NumOldInsts);
+	for (int32 OldInstIdx = 0; OldInstIdx < NumOldInsts; ++OldInstIdx)
+	{
+		OldIdSlotMap.Add(InOutInstanceIds[OldInstIdx], OldInstIdx);
+		if (OldIdSlotMap.Num() != OldInstIdx + 1)  // Ids are NOT unique
+			return false;
+	}
+
+	// Match new instances to old slots
+	TArray<int32> SlotInstIndices;  // The new InstIdx that each slot holds
+	SlotInstIndices.Init(INDEX_NONE, NumOldInsts);
+	TArray<int32> AddedInstIndices;
+	for (int32 InstIdx = 0; InstIdx < NumNewInsts; ++InstIdx)
+	{
+		if (const int32* FoundSlotPtr = OldIdSlotMap.Find(NewInstanceIds[InstIdx]))
+		{
+			if (SlotInstIndices[*FoundSlotPtr] != INDEX_NONE)  // Ids are NOT unique
+				return false;
+			SlotInstIndices[*FoundSlotPtr] = InstIdx;
+		}
+		else
+			AddedInstIndices.Add(InstIdx);
+	}
+
+	// Added instances reuse the slots of removed ones first
+	TBitArray<> DirtySlots(false, NumOldInsts);
+	int32 NumPlacedAdds = 0;
+	for (int32 Slot = 0; (Slot < NumOldInsts) && (NumPlacedAdds < AddedInstIndices.Num()); ++Slot)
+	{
+		if (SlotInstIndices[Slot] == INDEX_NONE)
+		{
+			SlotInstIndices[Slot] = AddedInstIndices[NumPlacedAdds++];
+			DirtySlots[Slot] = true;
+		}
+	}
+
+	// If there are still holes, fill them by instances from the tail, so that we only need to remove instances at the tail
+	if (NumNewInsts < NumOldInsts)
+	{
+		int32 TailSlot = NumOldInsts - 1;
+		for (int32 Slot = 0; Slot < NumNewInsts; ++Slot)
+		{
+			if (SlotInstIndices[Slot] != INDEX_NONE)
+				continue;
+
+			while (SlotInstIndices[TailSlot] == INDEX_NONE)
+				--TailSlot;
+
+			SlotInstIndices[Slot] = SlotInstIndices[TailSlot];
+			SlotInstIndices[TailSlot] = INDEX_NONE;
+			DirtySlots[Slot] = true;
+			--TailSlot;
+		}
+
+		TArray<int32> InstIndicesToRemove;
+		InstIndicesToRemove.Reserve(NumOldInsts - NumNewInsts);
+		for (int32 InstIdx = NumOldInsts - 1; InstIdx >= NumNewInsts; --InstIdx)
+			InstIndicesToRemove.Add(InstIdx);
+
+		// Disable collision when remove instances, to have better performance. Do nothing if collision has already been disabled by caller
+		FHoudiniComponentNoCollisionScope RemoveNoCollisionScope(ISMC);
+
+		ISMC->SelectedInstances.Empty();  // Clear selected instance to avoid crash
+		ISMC->RemoveInstances(InstIndicesToRemove);
+	}
+
+	auto GetCustomFloatsLambda = [&](const int32& InstIdx)
+		{
+			return MakeArrayView(InstCustomFloats.GetData() + InstIdx * NumCustomFloats, NumCustomFloats);
+		};
+
+	// Only update moved and changed instances
+	bool bHasChanged = (NumNewInsts != NumOldInsts);
+	const int32 NumKeptSlots = FMath::Min(NumOldInsts, NumNewInsts);
+	for (int32 Slot = 0; Slot < NumKeptSlots; ++Slot)
+	{
+		const int32& InstIdx = SlotInstIndices[Slot];
+		const FTransform& NewTransform = Transforms[InstPointIndices[InstIdx]];
+		FTransform OldTransform;
+		if (DirtySlots[Slot] || !ISMC->GetInstanceTransform(Slot, OldTransform) || !OldTransform.Equals(NewTransform))
+		{
+			ISMC->UpdateInstanceTransform(Slot, NewTransform, false, false, true);
+			bHasChanged = true;
+		}
+
+		if ((NumCustomFloats >= 1) && (DirtySlots[Slot] ||
+			FMemory::Memcmp(ISMC->PerInstanceSMCustomData.GetData() + Slot * NumCustomFloats, InstCustomFloats.GetData() + InstIdx * NumCustomFloats, NumCustomFloats * sizeof(float))))
+		{
+			ISMC->SetCustomData(Slot, GetCustomFloatsLambda(InstIdx));
+			bHasChanged = true;
+		}
+	}
+
+	// Append the rest added instances
+	if (NumPlacedAdds < AddedInstIndices.Num())
+	{
+		TArray<FTransform> TransformsToAdd;
+		TransformsToAdd.Reserve(AddedInstIndices.Num() - NumPlacedAdds);
+		for (int32 AddIdx = NumPlacedAdds; AddIdx < AddedInstIndices.Num(); ++AddIdx)
+			TransformsToAdd.Add(Transforms[InstPointIndices[AddedInstIndices[AddIdx]]]);
+		ISMC->AddInstances(TransformsToAdd, false);
+
+		for (int32 AddIdx = NumPlacedAdds; (NumCustomFloats >= 1) && (AddIdx < AddedInstIndices.Num()); ++AddIdx)
+			ISMC->SetCustomData(NumOldInsts + AddIdx - NumPlacedAdds, GetCustomFloatsLambda(AddedInstIndices[AddIdx]));
+	}
+
+	if (bHasChanged)
+		ISMC->MarkRenderStateDirty();
+
+	// Record ids by slots
+	InOutInstanceIds.SetNumUninitialized(NumNewInsts);
+	for (int32 Slot = 0; Slot < NumKeptSlots; ++Slot)
+		InOutInstanceIds[Slot] = NewInstanceIds[SlotInstIndices[Slot]];
+	for (int32 AddIdx = NumPlacedAdds; AddIdx < AddedInstIndices.Num(); ++AddIdx)
+		InOutInstanceIds[NumOldInsts + AddIdx - NumPlacedAdds] = NewInstanceIds[AddedInstIndices[AddIdx]];
+
+	return true;
+}
+
 bool UHoudiniOutputInstancer::HapiUpdate(const HAPI_GeoInfo& GeoInfo, const TArray<HAPI_PartInfo>& PartInfos)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(HoudiniOutputInstancer);
@@ -1104,14 +1283,7 @@ bool UHoudiniOutputInstancer::HapiUpdate(const HAPI_GeoInfo& GeoInfo, const TArr
 					HAPI_SRT, HapiTransforms.GetData(), 0, PointCount))
 
 			Transforms.SetNumUninitialized(PointCount);
-			for (int32 PointIdx = 0; PointIdx < PointCount; ++PointIdx)
-			{
-				const HAPI_Transform& HapiTransform = HapiTransforms[PointIdx];
-				FTransform& Transform = Transforms[PointIdx];
-				Transform.SetLocation(FVector(HapiTransform.position[0], HapiTransform.position[2], HapiTransform.position[1]) * POSITION_SCALE_TO_UNREAL_F);
-				Transform.SetRotation(FQuat(HapiTransform.rotationQuaternion[0], HapiTransform.rotationQuaternion[2], HapiTransform.rotationQuaternion[1], -HapiTransform.rotationQuaternion[3]));
-				Transform.SetScale3D(FVector(HapiTransform.scale[0], HapiTransform.scale[2], HapiTransform.scale[1]));
-			}
+			FHoudiniEngineUtils::ConvertHapiTransforms(HapiTransforms.GetData(), Transforms.GetData(), PointCount);
 		}
 		
 		HAPI_AttributeOwner SplitActorsOwner = FHoudiniEngineUtils::QueryAttributeOwner(AttribNames, PartInfo.attributeCounts, HAPI_ATTRIB_UNREAL_SPLIT_ACTORS);
@@ -1119,6 +1291,22 @@ bool UHoudiniOutputInstancer::HapiUpdate(const HAPI_GeoInfo& GeoInfo, const TArr
 		HOUDINI_FAIL_RETURN(FHoudiniEngineUtils::HapiGetEnumAttributeData(NodeId, PartId,
 			HAPI_ATTRIB_UNREAL_SPLIT_ACTORS, bSplitActors, SplitActorsOwner));
 
+		// Retrieve stable instance ids for ISMC, so that we could only apply changed instances
+		TArray<int32> InstanceIds;
+		if (FHoudiniEngineUtils::IsAttributeExists(AttribNames, PartInfo.attributeCounts, HAPI_ATTRIB_UNREAL_INSTANCE_ID, HAPI_ATTROWNER_POINT))
+		{
+			HAPI_AttributeInfo AttribInfo;
+			HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetAttributeInfo(FHoudiniEngine::Get().GetSession(), NodeId, PartId,
+				HAPI_ATTRIB_UNREAL_INSTANCE_ID, HAPI_ATTROWNER_POINT, &AttribInfo));
+			if ((FHoudiniEngineUtils::ConvertStorageType(AttribInfo.storage) == EHoudiniStorageType::Int) && (AttribInfo.count == Transforms.Num()))
+			{
+				AttribInfo.tupleSize = 1;
+				InstanceIds.SetNumUninitialized(AttribInfo.count);
+				HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetAttributeIntData(FHoudiniEngine::Get().GetSession(), NodeId, PartId,
+					HAPI_ATTRIB_UNREAL_INSTANCE_ID, &AttribInfo, -1, InstanceIds.GetData(), 0, AttribInfo.count));
+			}
+		}
+
 		// Retrieve custom floats for ISMC
 		const TArray<HAPI_AttributeInfo>& CustomFloatAttribInfos = Part.CustomFloatAttribInfos;
 		TArray<TArray<float>> CustomFloatsData;
@@ -1337,115 +1525,105 @@ bool UHoudiniOutputInstancer::HapiUpdate(const HAPI_GeoInfo& GeoInfo, const TArr
 									if (!NewISMC->GetRelativeTransform().Equals(FTransform::Identity))
 										NewISMC->SetRelativeTransform(FTransform::Identity);
 
-									struct FHoudiniComponentNoCollisionScope
-									{
-										UStaticMeshComponent* Component = nullptr;
-										FName CollisionProfileName;
-										ECollisionEnabled::Type CollisionEnabled = ECollisionEnabled::NoCollision;
-										bool bUseDefaultCollision = false;
-
-										FHoudiniComponentNoCollisionScope(UStaticMeshComponent* InComponent)
-										{
-											if (IsValid(InComponent))
-											{
-												Component = InComponent;
-												CollisionEnabled = Component->GetCollisionEnabled();
-												if (CollisionEnabled != ECollisionEnabled::NoCollision)
-												{
-													bUseDefaultCollision = Component->bUseDefaultCollision;
-													CollisionProfileName = Component->GetCollisionProfileName();
-													Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-												}
-											}
-										}
-
-										~FHoudiniComponentNoCollisionScope()
-										{
-											if (IsValid(Component))
-											{
-												if (CollisionEnabled != ECollisionEnabled::NoCollision)
-												{
-													if (CollisionProfileName != UCollisionProfile::CustomCollisionProfileName)
-														Component->SetCollisionProfileName(CollisionProfileName);
-													else
-														Component->SetCollisionEnabled(CollisionEnabled);
-
-													if (bUseDefaultCollision)
-														Component->bUseDefaultCollision = true;
-												}
-											}
-										}
-									};
-
 									{
 #if ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 4)) || (ENGINE_MAJOR_VERSION > 5)
 										// Disable collision when output HISMC, to have better performance.  // TODO: check out why?
 										FHoudiniComponentNoCollisionScope NoCollisionScope(Cast<UHierarchicalInstancedStaticMeshComponent>(NewISMC));
 #endif
 
-										auto UpdateInstancesLambda = [&](const int32& NumInsts)
-											{
-												if (NumInsts >= 1)
-												{
-													TArray<FTransform> TransformsToUpdate;
-													TransformsToUpdate.Reserve(NumInsts);
-													for (int32 InstIdx = 0; InstIdx < NumInsts; ++InstIdx)
-														TransformsToUpdate.Add(Transforms[InstPointIndices[InstIdx]]);
-													NewISMC->BatchUpdateInstancesTransforms(0, TransformsToUpdate);
-												}
-											};
-
 										const int32 NumOldInsts = NewISMC->GetInstanceCount();
 										const int32 NumNewInsts = InstPointIndices.Num();
 
-										if (NumOldInsts < NumNewInsts)
+										// Gather all custom floats into a single buffer, then set each instance by views
+										TArray<float> InstCustomFloats;
+										if (NumCustomFloats >= 1)
 										{
-											UpdateInstancesLambda(NumOldInsts);
-
-											TArray<FTransform> TransformsToCreate;
-											TransformsToCreate.Reserve(NumNewInsts - NumOldInsts);
-											for (int32 InstIdx = NumOldInsts; InstIdx < NumNewInsts; ++InstIdx)
-												TransformsToCreate.Add(Transforms[InstPointIndices[InstIdx]]);
-											NewISMC->AddInstances(TransformsToCreate, false);
+											InstCustomFloats.SetNumUninitialized(NumNewInsts * NumCustomFloats);
+											ParallelFor(NumNewInsts, [&](int32 InstIdx)
+												{
+													float* InstCustomFloatsPtr = InstCustomFloats.GetData() + InstIdx * NumCustomFloats;
+													for (int8 CustomFloatIdx = 0; CustomFloatIdx < NumCustomFloats; ++CustomFloatIdx)
+														InstCustomFloatsPtr[CustomFloatIdx] = CustomFloatsData[CustomFloatIdx][POINT_ATTRIB_ENTRY_IDX(CustomFloatAttribInfos[CustomFloatIdx].owner, InstPointIndices[InstIdx])];
+												}, NumNewInsts < HOUDINI_TRANSFORM_CONVERT_BATCH_SIZE);
 										}
-										else if (NumOldInsts == NumNewInsts)
+
+										TArray<int32> NewInstanceIds;
+										if (!InstanceIds.IsEmpty())
 										{
-											UpdateInstancesLambda(NumNewInsts);
+											NewInstanceIds.SetNumUninitialized(NumNewInsts);
+											for (int32 InstIdx = 0; InstIdx < NumNewInsts; ++InstIdx)
+												NewInstanceIds[InstIdx] = InstanceIds[InstPointIndices[InstIdx]];
 										}
-										else if (NumOldInsts > NumNewInsts)
+
+										if (NewInstanceIds.IsEmpty() || !DiffUpdateInstances(NewISMC, NewISMOutput.GetInstanceIds(),
+											NewInstanceIds, Transforms, InstPointIndices, NumCustomFloats, InstCustomFloats))
 										{
-											TArray<int32> InstIndicesToRemove;
-											InstIndicesToRemove.Reserve(NumOldInsts - NumNewInsts);
-											for (int32 InstIdx = NumOldInsts - 1; InstIdx >= NumNewInsts; --InstIdx)
-												InstIndicesToRemove.Add(InstIdx);
+											// InstPointIndices are ascending and unique, so if they cover all points, we could hand Transforms to ISMC directly without gathering
+											const bool bIsAllPoints = (NumNewInsts == Transforms.Num()) && (InstPointIndices[0] == 0) && (InstPointIndices.Last() == NumNewInsts - 1);
+											auto GatherTransformsLambda = [&](const int32& StartInstIdx, const int32& EndInstIdx)
+												{
+													TArray<FTransform> InstTransforms;
+													InstTransforms.SetNumUninitialized(EndInstIdx - StartInstIdx);
+													ParallelFor(InstTransforms.Num(), [&](int32 Idx)
+														{
+															InstTransforms[Idx] = Transforms[InstPointIndices[StartInstIdx + Idx]];
+														}, InstTransforms.Num() < HOUDINI_TRANSFORM_CONVERT_BATCH_SIZE);
+													return InstTransforms;
+												};
+
+											auto UpdateInstancesLambda = [&](const int32& NumInsts)
+												{
+													if (NumInsts >= 1)
+													{
+														if (bIsAllPoints && (NumInsts == NumNewInsts))
+															NewISMC->BatchUpdateInstancesTransforms(0, Transforms);
+														else
+															NewISMC->BatchUpdateInstancesTransforms(0, GatherTransformsLambda(0, NumInsts));
+													}
+												};
+
+											if (NumOldInsts < NumNewInsts)
+											{
+												UpdateInstancesLambda(NumOldInsts);
 
-											// Disable collision when remove instances, to have better performance.  // TODO: check out why?
+												if (bIsAllPoints && (NumOldInsts == 0))
+													NewISMC->AddInstances(Transforms, false);
+												else
+													NewISMC->AddInstances(GatherTransformsLambda(NumOldInsts, NumNewInsts), false);
+											}
+											else if (NumOldInsts == NumNewInsts)
+											{
+												UpdateInstancesLambda(NumNewInsts);
+											}
+											else if (NumOldInsts > NumNewInsts)
+											{
+												TArray<int32> InstIndicesToRemove;
+												InstIndicesToRemove.Reserve(NumOldInsts - NumNewInsts);
+												for (int32 InstIdx = NumOldInsts - 1; InstIdx >= NumNewInsts; --InstIdx)
+													InstIndicesToRemove.Add(InstIdx);
+
+												// Disable collision when remove instances, to have better performance.  // TODO: check out why?
 #if ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 4)) || (ENGINE_MAJOR_VERSION > 5)
-											FHoudiniComponentNoCollisionScope RemoveNoCollisionScope(NoCollisionScope.Component ? nullptr : NewISMC);  // ensure only once
+												FHoudiniComponentNoCollisionScope RemoveNoCollisionScope(NoCollisionScope.Component ? nullptr : NewISMC);  // ensure only once
 #else
-											FHoudiniComponentNoCollisionScope RemoveNoCollisionScope(NewISMC);
+												FHoudiniComponentNoCollisionScope RemoveNoCollisionScope(NewISMC);
 #endif
 
-											if (!InstIndicesToRemove.IsEmpty())
-											{
-												NewISMC->SelectedInstances.Empty();  // Clear selected instance to avoid crash
-												NewISMC->RemoveInstances(InstIndicesToRemove);
+												if (!InstIndicesToRemove.IsEmpty())
+												{
+													NewISMC->SelectedInstances.Empty();  // Clear selected instance to avoid crash
+													NewISMC->RemoveInstances(InstIndicesToRemove);
+												}
+
+												UpdateInstancesLambda(NumNewInsts);
 											}
 
-											UpdateInstancesLambda(NumNewInsts);
-										}
+											// Set Custom Floats
+											NewISMC->SetNumCustomDataFloats(int32(NumCustomFloats));
+											for (int32 InstIdx = 0; (NumCustomFloats >= 1) && (InstIdx < NumNewInsts); ++InstIdx)
+												NewISMC->SetCustomData(InstIdx, MakeArrayView(InstCustomFloats.GetData() + InstIdx * NumCustomFloats, NumCustomFloats));
 
-										// Set Custom Floats
-										NewISMC->SetNumCustomDataFloats(int32(NumCustomFloats));
-										if (NumCustomFloats >= 1)
-										{
-											for (int32 InstIdx = 0; InstIdx < NumNewInsts; ++InstIdx)
-											{
-												TArray<float> InstCustomFloats;
-												for (int8 CustomFloatIdx = 0; CustomFloatIdx < NumCustomFloats; ++CustomFloatIdx)
-													InstCustomFloats.Add(CustomFloatsData[CustomFloatIdx][POINT_ATTRIB_ENTRY_IDX(CustomFloatAttribInfos[CustomFloatIdx].owner, InstPointIndices[InstIdx])]);
-												NewISMC->SetCustomData(InstIdx, InstCustomFloats);
-											}
+											NewISMOutput.GetInstanceIds() = NewInstanceIds;  // Will be empty if there is no stable ids
 										}
 									}  // EndNoCollisionScope
 
@@ -21,6 +21,20 @@
 
 #define INVALID_HEIGHTFIELD_EXTENT FIntRect(MAX_int32, MAX_int32, MIN_int32, MIN_int32)  // See ULandscapeInfo::GetLandscapeExtent
 
+bool FHoudiniLandscapeOutputBuilder::GetClaimRules(TArray<FHoudiniOutputClaimRule>& OutRules) const
+{
+	// Volumes without landscape output mode are always held by output
+	FHoudiniOutputClaimRule& HeightfieldRule = OutRules.AddDefaulted_GetRef();
+	HeightfieldRule.PartTypeMask = (1u << HAPI_PARTTYPE_VOLUME);
+	HeightfieldRule.ExcludedAttribs.Add({ HAPI_ATTRIB_UNREAL_LANDSCAPE_OUTPUT_MODE, EHoudiniAttributeOwner::Invalid });
+
+	FHoudiniOutputClaimRule& OutputModeRule = OutRules.AddDefaulted_GetRef();
+	OutputModeRule.PartTypeMask = (1u << HAPI_PARTTYPE_VOLUME);
+	OutputModeRule.RequiredAttribs.Add({ HAPI_ATTRIB_UNREAL_LANDSCAPE_OUTPUT_MODE, EHoudiniAttributeOwner::Invalid });
+	OutputModeRule.bFinal = false;  // Need to check landscape output mode value
+	return true;
+}
+
 bool FHoudiniLandscapeOutputBuilder::HapiIsPartValid(const int32& NodeId, const HAPI_PartInfo& PartInfo, bool& bOutIsValid, bool& bOutShouldHoldByOutput)
 {
 	bOutIsValid = false;
@@ -991,15 +1005,9 @@ static void ConvertHeightmapData(const float* FloatData, const int32& Heightfiel
 	const int32 HoudiniYSize = HeightfieldExtent.Height() + 1;
 	LandscapeData.SetNumUninitialized(HoudiniXSize * HoudiniYSize);
 
-	ParallelFor(HoudiniXSize, [&](const int32& nX)
-		{
-			const int32 YOffset = HeightfieldExtent.Min.Y + (nX + HeightfieldExtent.Min.X) * HeightfieldXSize;
-			for (int32 nY = 0; nY < HoudiniYSize; nY++)
-			{
-				const float& HeightfieldValue = FloatData[nY + YOffset];
-				LandscapeData[nY * HoudiniXSize + nX] = FMath::Clamp(FMath::RoundToInt((HeightfieldValue * Scale + 256.0f) * float(65535.0 / 512.0)), 0, 65535);
-			}
-		});
+	FHoudiniEngineUtils::TransposeData(LandscapeData.GetData(), HoudiniXSize,
+		FloatData + (HeightfieldExtent.Min.Y + size_t(HeightfieldExtent.Min.X) * HeightfieldXSize), HeightfieldXSize,
+		HoudiniYSize, HoudiniXSize, [Scale](const float& HeightfieldValue) { return uint16(FMath::Clamp(FMath::RoundToInt((HeightfieldValue * Scale + 256.0f) * float(65535.0 / 512.0)), 0, 65535)); });
 
 	const int32 UnrealXSize = LandscapeExtent.Width() + 1;
 	const int32 UnrealYSize = LandscapeExtent.Height() + 1;
@@ -1014,15 +1022,9 @@ static void ConvertWeightmapData(const float* FloatData, const int32& Heightfiel
 	const int32 HoudiniYSize = HeightfieldExtent.Height() + 1;
 	LandscapeData.SetNumUninitialized(HoudiniXSize * HoudiniYSize);
 
-	ParallelFor(HoudiniXSize, [&](const int32& nX)
-		{
-			const int32 YOffset = HeightfieldExtent.Min.Y + (nX + HeightfieldExtent.Min.X) * HeightfieldXSize;
-			for (int32 nY = 0; nY < HoudiniYSize; nY++)
-			{
-				const float& HeightfieldValue = FloatData[nY + YOffset];
-				LandscapeData[nY * HoudiniXSize + nX] = FMath::Clamp(FMath::RoundToInt(HeightfieldValue * 255.f), 0, 255);
-			}
-		});
+	FHoudiniEngineUtils::TransposeData(LandscapeData.GetData(), HoudiniXSize,
+		FloatData + (HeightfieldExtent.Min.Y + size_t(HeightfieldExtent.Min.X) * HeightfieldXSize), HeightfieldXSize,
+		HoudiniYSize, HoudiniXSize, [](const float& HeightfieldValue) { return uint8(FMath::Clamp(FMath::RoundToInt(HeightfieldValue * 255.f), 0, 255)); });
 
 	const int32 UnrealXSize = LandscapeExtent.Width() + 1;
 	const int32 UnrealYSize = LandscapeExtent.Height() + 1;
@@ -1039,15 +1041,9 @@ static void ConvertAlphaData(const float* FloatData, const int32& HeightfieldXSi
 
 	const UMaterial* Material = IsValid(HoleMaterial) ? HoleMaterial->GetMaterial() : nullptr;
 	const float Scale = Material ? (Material->OpacityMaskClipValue * 2.0f) : (1.0f / 1.5f);
-	ParallelFor(HoudiniXSize, [&](const int32& nX)
-		{
-			const int32 YOffset = HeightfieldExtent.Min.Y + (nX + HeightfieldExtent.Min.X) * HeightfieldXSize;
-			for (int32 nY = 0; nY < HoudiniYSize; nY++)
-			{
-				const float& HeightfieldValue = FloatData[nY + YOffset];
-				LandscapeData[nY * HoudiniXSize + nX] = FMath::Clamp(FMath::RoundToInt((1.0 - HeightfieldValue * Scale) * 255.f), 0, 255);
-			}
-		});
+	FHoudiniEngineUtils::TransposeData(LandscapeData.GetData(), HoudiniXSize,
+		FloatData + (HeightfieldExtent.Min.Y + size_t(HeightfieldExtent.Min.X) * HeightfieldXSize), HeightfieldXSize,
+		HoudiniYSize, HoudiniXSize, [Scale](const float& HeightfieldValue) { return uint8(FMath::Clamp(FMath::RoundToInt((1.0 - HeightfieldValue * Scale) * 255.f), 0, 255)); });
 
 	const int32 UnrealXSize = LandscapeExtent.Width() + 1;
 	const int32 UnrealYSize = LandscapeExtent.Height() + 1;
@@ -18,6 +18,16 @@
 #include "HoudiniAttribute.h"
 
 
+bool FHoudiniMaterialInstanceOutputBuilder::GetClaimRule(FHoudiniOutputClaimRule& OutRule) const
+{
+	OutRule.PartTypeMask = (1u << HAPI_PARTTYPE_MESH);
+	OutRule.GeometryFilter = EHoudiniPartGeometryFilter::Points;
+	OutRule.RequiredAttribs.Add({ HAPI_ATTRIB_UNREAL_MATERIAL_INSTANCE, EHoudiniAttributeOwner::Point });
+	OutRule.ExcludedAttribs.Add({ HAPI_ATTRIB_UNREAL_INSTANCE, EHoudiniAttributeOwner::Point });  // Instancer outputs
+	OutRule.bFinal = false;  // Need to check attribute storage
+	return true;
+}
+
 bool FHoudiniMaterialInstanceOutputBuilder::HapiIsPartValid(const int32& NodeId, const HAPI_PartInfo& PartInfo, bool& bOutIsValid, bool& bOutShouldHoldByOutput)
 {
 	bOutIsValid = false;
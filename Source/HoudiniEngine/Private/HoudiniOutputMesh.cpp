@@ -32,6 +32,13 @@
 //#include "MeshDescriptionBuilder.h"
 //#include "Runtime/MeshConversion/Private/MeshDescriptionToDynamicMesh.cpp"
 
+bool FHoudiniMeshOutputBuilder::GetClaimRule(FHoudiniOutputClaimRule& OutRule) const
+{
+	OutRule.PartTypeMask = (1u << HAPI_PARTTYPE_MESH);
+	OutRule.GeometryFilter = EHoudiniPartGeometryFilter::Faces;
+	return true;
+}
+
 bool FHoudiniMeshOutputBuilder::HapiIsPartValid(const int32& NodeId, const HAPI_PartInfo& PartInfo, bool& bOutIsValid, bool& bOutShouldHoldByOutput)
 {
 	bOutIsValid = ((PartInfo.type == HAPI_PARTTYPE_MESH) && (PartInfo.faceCount >= 1) && (PartInfo.vertexCount >= 3));
@@ -445,6 +452,8 @@ FORCEINLINE static UMaterialInterface* GetMeshMaterial(const TArray<UMaterialInt
 }
 
 
+#define HOUDINI_OUTPUT_CLASSIFY_CHUNK_SIZE 4096
+
 bool UHoudiniOutputMesh::HapiUpdate(const HAPI_GeoInfo& GeoInfo, const TArray<HAPI_PartInfo>& PartInfos)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(HoudiniOutputMesh);
@@ -480,6 +489,20 @@ bool UHoudiniOutputMesh::HapiUpdate(const HAPI_GeoInfo& GeoInfo, const TArray<HA
 		TArray<FString> EditableGroupNames;
 		TMap<int32, FHoudiniMeshTrianglesHolder> SplitMeshMap;
 
+		// Retrieved in HAPI phase, and will be used to classify triangles in parallel
+		bool bIsMainGeoEditable = false;
+		TArray<TArray<int32>> EditableGroupships;
+		TArray<int32> CollisionGroupship;
+		TArray<TArray<int32>> LodGroupships;  // Starts with second lod, may be "lod_1"
+		HAPI_AttributeOwner MeshOutputModeOwner = HAPI_ATTROWNER_INVALID;
+		TArray<int8> MeshOutputModes;
+		TArray<int32> SplitKeys;  // Maybe int or HAPI_StringHandle
+		HAPI_AttributeOwner SplitAttribOwner = HAPI_ATTROWNER_PRIM;
+		TMap<HAPI_StringHandle, FString> SplitValueMap;
+		HAPI_AttributeOwner PartialOutputModeOwner = HAPI_ATTROWNER_INVALID;
+		TArray<int8> PartialOutputModes;
+		bool bPartialUpdate = false;
+
 		FString GetGroupName(const int32& GroupIdx) const
 		{
 			return (GroupIdx < 0) ? TEXT(HAPI_GROUP_MAIN_GEO) : EditableGroupNames[GroupIdx];
@@ -516,58 +539,121 @@ bool UHoudiniOutputMesh::HapiUpdate(const HAPI_GeoInfo& GeoInfo, const TArray<HA
 
 
 		// -------- Get EditableGroupships for UHoudiniMeshComponent generating --------
-		TArray<TArray<int32>> EditableGroupships;
 		if (bCanHaveEditableOutput)  // Editable mesh must be UHoudiniMeshComponent
 		{
-			HapiGetEditableGroups(Part.EditableGroupNames, EditableGroupships, bIsMainGeoEditable,
+			HapiGetEditableGroups(Part.EditableGroupNames, Part.EditableGroupships, bIsMainGeoEditable,
 				NodeId, PartInfo, PrimGroupNames);
 		}
+		Part.bIsMainGeoEditable = bIsMainGeoEditable;
 
 
 		// -------- Retrieve collision and LOD groups --------
 		bool bCollisionGroupShipConst = false;
-		TArray<int32> CollisionGroupship;
 		if (PrimGroupNames.Contains(HAPI_GROUP_COLLISION_GEO))
 			HOUDINI_FAIL_RETURN(FHoudiniEngineUtils::HapiGetGroupMembership(NodeId, PartId,
-				PartInfo.faceCount, PartInfo.isInstanced, HAPI_GROUPTYPE_PRIM, HAPI_GROUP_COLLISION_GEO, CollisionGroupship, bCollisionGroupShipConst));
+				PartInfo.faceCount, PartInfo.isInstanced, HAPI_GROUPTYPE_PRIM, HAPI_GROUP_COLLISION_GEO, Part.CollisionGroupship, bCollisionGroupShipConst));
 
-		TArray<TArray<int32>> LodGroupships;  // Starts with second lod, may be "lod_1"
 		HOUDINI_FAIL_RETURN(HapiGetLodGroupShips(NodeId, PartId,
-			PrimGroupNames, PartInfo.faceCount, PartInfo.isInstanced, LodGroupships));
+			PrimGroupNames, PartInfo.faceCount, PartInfo.isInstanced, Part.LodGroupships));
 
 		// -------- Retrieve mesh_output_mode ---------
-		HAPI_AttributeOwner MeshOutputModeOwner = FHoudiniEngineUtils::QueryAttributeOwner(AttribNames, PartInfo.attributeCounts,
+		Part.MeshOutputModeOwner = FHoudiniEngineUtils::QueryAttributeOwner(AttribNames, PartInfo.attributeCounts,
 			HAPI_ATTRIB_UNREAL_OUTPUT_MESH_TYPE);
-		TArray<int8> MeshOutputModes;
 		HOUDINI_FAIL_RETURN(FHoudiniEngineUtils::HapiGetEnumAttributeData(NodeId, PartId,
-			HAPI_ATTRIB_UNREAL_OUTPUT_MESH_TYPE, GetMeshOutputModeLambda, MeshOutputModes, MeshOutputModeOwner));
+			HAPI_ATTRIB_UNREAL_OUTPUT_MESH_TYPE, GetMeshOutputModeLambda, Part.MeshOutputModes, Part.MeshOutputModeOwner));
 
 
 		// -------- Retrieve vertex list --------
 		Part.Vertices.SetNumUninitialized(PartInfo.vertexCount);
 		HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetVertexList(FHoudiniEngine::Get().GetSession(), NodeId, PartId,
 			Part.Vertices.GetData(), 0, PartInfo.vertexCount));
-		const TArray<int32>& Vertices = Part.Vertices;
 
 
 		// -------- Retrieve split values and partial output modes if exists --------
-		TArray<int32> SplitKeys;  // Maybe int or HAPI_StringHandle
-		HAPI_AttributeOwner SplitAttribOwner = HAPI_ATTROWNER_PRIM;
-		TMap<HAPI_StringHandle, FString> SplitValueMap;
 		HOUDINI_FAIL_RETURN(FHoudiniOutputUtils::HapiGetSplitValues(NodeId, PartId, AttribNames, PartInfo.attributeCounts,
-			SplitKeys, SplitValueMap, SplitAttribOwner));
-		const bool bHasSplitValues = !SplitKeys.IsEmpty();
+			Part.SplitKeys, Part.SplitValueMap, Part.SplitAttribOwner));
 
-		HAPI_AttributeOwner PartialOutputModeOwner = bHasSplitValues ? FHoudiniEngineUtils::QueryAttributeOwner(AttribNames,
+		Part.PartialOutputModeOwner = !Part.SplitKeys.IsEmpty() ? FHoudiniEngineUtils::QueryAttributeOwner(AttribNames,
 			PartInfo.attributeCounts, HAPI_ATTRIB_PARTIAL_OUTPUT_MODE) : HAPI_ATTROWNER_INVALID;
-		TArray<int8> PartialOutputModes;
 		HOUDINI_FAIL_RETURN(FHoudiniEngineUtils::HapiGetEnumAttributeData(NodeId, PartId,
-			HAPI_ATTRIB_PARTIAL_OUTPUT_MODE, PartialOutputModes, PartialOutputModeOwner));
-		if (!PartialOutputModes.IsEmpty())  // If has i@partial_output_mode attrib, then we should treat packed mesh as normal mesh, because PartId record in unchanged is out-of-data, we can NOT instantiate them
+			HAPI_ATTRIB_PARTIAL_OUTPUT_MODE, Part.PartialOutputModes, Part.PartialOutputModeOwner));
+		if (!Part.PartialOutputModes.IsEmpty())  // If has i@partial_output_mode attrib, then we should treat packed mesh as normal mesh, because PartId record in unchanged is out-of-data, we can NOT instantiate them
 			Part.Info.isInstanced = false;  // As we have already retrieved groups, the HAPI_PartInfo::isInstanced can be set here
+	}
+
+
+	// -------- Split mesh --------
+	// No HAPI calls below, so parts could be classified in parallel, and each part's triangles are also classified in parallel chunks,
+	// then binned in order, as the first triangle of each split value determines the PartialOutputMode of the holder
+	ParallelFor(Parts.Num(), [&](int32 PartIdx)
+	{
+		FHoudiniMeshPart& Part = Parts[PartIdx];
+		const HAPI_PartInfo& PartInfo = Part.Info;
+		const TArray<int32>& Vertices = Part.Vertices;
+		const bool bHasSplitValues = !Part.SplitKeys.IsEmpty();
+
+		// < PartialOutputMode, MeshOutputMode >, INDEX_NONE means this triangle should be discarded
+		TArray<TPair<int8, int8>> TriModes;
+		TArray<int32> TriGroupIdcs;
+		TriModes.SetNumUninitialized(PartInfo.faceCount);
+		TriGroupIdcs.SetNumUninitialized(PartInfo.faceCount);
+		ParallelFor(FMath::DivideAndRoundUp(PartInfo.faceCount, HOUDINI_OUTPUT_CLASSIFY_CHUNK_SIZE), [&](int32 ChunkIdx)
+		{
+			const int32 EndTriIdx = FMath::Min((ChunkIdx + 1) * HOUDINI_OUTPUT_CLASSIFY_CHUNK_SIZE, PartInfo.faceCount);
+			for (int32 TriIdx = ChunkIdx * HOUDINI_OUTPUT_CLASSIFY_CHUNK_SIZE; TriIdx < EndTriIdx; ++TriIdx)
+			{
+				const int8 PartialOutputMode = FMath::Clamp(Part.PartialOutputModes.IsEmpty() ? HAPI_PARTIAL_OUTPUT_MODE_REPLACE :
+					Part.PartialOutputModes[MeshAttributeEntryIdx(Part.PartialOutputModeOwner, TriIdx, HAPI_ATTROWNER_PRIM, Vertices)],
+					HAPI_PARTIAL_OUTPUT_MODE_REPLACE, HAPI_PARTIAL_OUTPUT_MODE_REMOVE);
 
+				// Judge is HoudiniMesh and query EditableGroupIdx
+				int8 MeshOutputMode = FMath::Clamp(Part.MeshOutputModes.IsEmpty() ? (Part.bIsMainGeoEditable ? HAPI_UNREAL_OUTPUT_MESH_TYPE_HOUDINIMESH : HAPI_UNREAL_OUTPUT_MESH_TYPE_STATICMESH) :
+					Part.MeshOutputModes[MeshAttributeEntryIdx(Part.MeshOutputModeOwner, TriIdx, HAPI_ATTROWNER_PRIM, Vertices)],
+					HAPI_UNREAL_OUTPUT_MESH_TYPE_STATICMESH, HAPI_UNREAL_OUTPUT_MESH_TYPE_HOUDINIMESH);  // We should clamp it, to ensure the mode int is limit to 0 - 2
+
+				int32 EditIdx = -1;  // -1 represents "main_geo"
+				if (bCanHaveEditableOutput)
+				{
+					for (int32 EditableGroupIdx = 0; EditableGroupIdx < Part.EditableGroupships.Num(); ++EditableGroupIdx)
+					{
+						if (Part.EditableGroupships[EditableGroupIdx][TriIdx])
+						{
+							EditIdx = EditableGroupIdx;
+							MeshOutputMode = HAPI_UNREAL_OUTPUT_MESH_TYPE_HOUDINIMESH;  // If this is a solver node, and in editable group, we should force it to generate houdini mesh
+							break;
+						}
+					}
+				}
 
-		// -------- Split mesh --------
+				// Query LodIdx or Collision group
+				int32 LodIdx = 0;  // -1 represents collision
+				for (int32 LodGroupIdx = 0; LodGroupIdx < Part.LodGroupships.Num(); ++LodGroupIdx)
+				{
+					if (Part.LodGroupships[LodGroupIdx][TriIdx])
+					{
+						LodIdx = LodGroupIdx + 1;  // LodGroupships starts from "lod_1"
+						break;
+					}
+				}
+
+				if (LodIdx == 0)  // Means this face is not in any LOD Group
+				{
+					if (Part.CollisionGroupship.IsValidIndex(TriIdx) && Part.CollisionGroupship[TriIdx])
+						LodIdx = -1;  // -1 represents collision
+				}
+
+				if ((MeshOutputMode == HAPI_UNREAL_OUTPUT_MESH_TYPE_DYNAMICMESH) && (LodIdx >= 1))  // DynamicMesh does NOT support LODs
+					MeshOutputMode = INDEX_NONE;
+				else if ((MeshOutputMode == HAPI_UNREAL_OUTPUT_MESH_TYPE_HOUDINIMESH) && (LodIdx != 0))  // HoudiniMesh does NOT support LODs and collision
+					MeshOutputMode = INDEX_NONE;
+
+				TriModes[TriIdx] = TPair<int8, int8>(PartialOutputMode, MeshOutputMode);
+				TriGroupIdcs[TriIdx] = (MeshOutputMode == HAPI_UNREAL_OUTPUT_MESH_TYPE_HOUDINIMESH) ? EditIdx : LodIdx;
+			}
+		});
+
+		const TArray<int32>& SplitKeys = Part.SplitKeys;
+		const TMap<HAPI_StringHandle, FString>& SplitValueMap = Part.SplitValueMap;
 		TMap<int32, FHoudiniMeshTrianglesHolder>& SplitMap = Part.SplitMeshMap;  // SplitValue, <MeshOutputMesh, GroupIdx>, Triangles
 		FHoudiniMeshTrianglesHolder AllMesh(HAPI_PARTIAL_OUTPUT_MODE_REPLACE, FString());
 		TMap<TPair<int8, int32>, TArray<int32>>& AllGroupTrianglesMap = AllMesh.GroupTrianglesMap;  // Only for "no split values" condition
@@ -575,18 +661,15 @@ bool UHoudiniOutputMesh::HapiUpdate(const HAPI_GeoInfo& GeoInfo, const TArray<HA
 		{
 			// Judge PartialOutputMode, if remove && previous NOT set, then we will NOT parse the GroupIdx
 			const int32 SplitKey = bHasSplitValues ?
-				SplitKeys[MeshAttributeEntryIdx(SplitAttribOwner, TriIdx, HAPI_ATTROWNER_PRIM, Vertices)] : 0;
+				SplitKeys[MeshAttributeEntryIdx(Part.SplitAttribOwner, TriIdx, HAPI_ATTROWNER_PRIM, Vertices)] : 0;
 			FHoudiniMeshTrianglesHolder* FoundHolderPtr = bHasSplitValues ? SplitMap.Find(SplitKey) : nullptr;
 
-			const int8 PartialOutputMode = FMath::Clamp(PartialOutputModes.IsEmpty() ? HAPI_PARTIAL_OUTPUT_MODE_REPLACE :
-				PartialOutputModes[MeshAttributeEntryIdx(PartialOutputModeOwner, TriIdx, HAPI_ATTROWNER_PRIM, Vertices)],
-				HAPI_PARTIAL_OUTPUT_MODE_REPLACE, HAPI_PARTIAL_OUTPUT_MODE_REMOVE);
-
+			const int8& PartialOutputMode = TriModes[TriIdx].Key;
 			if (PartialOutputMode == HAPI_PARTIAL_OUTPUT_MODE_MODIFY)
-				bPartialUpdate = true;
+				Part.bPartialUpdate = true;
 			else if (PartialOutputMode == HAPI_PARTIAL_OUTPUT_MODE_REMOVE)  // If has PartialOutputModes, then must also HasSplitValues
 			{
-				bPartialUpdate = true;
+				Part.bPartialUpdate = true;
 				if (FoundHolderPtr)  // If previous triangles has defined PartialOutputMode, We should NOT change it
 				{
 					if (FoundHolderPtr->PartialOutputMode == HAPI_PARTIAL_OUTPUT_MODE_REMOVE)
@@ -599,56 +682,12 @@ bool UHoudiniOutputMesh::HapiUpdate(const HAPI_GeoInfo& GeoInfo, const TArray<HA
 				}
 			}
 
-			// Judge is HoudiniMesh and query EditableGroupIdx
-			int8 MeshOutputMode = FMath::Clamp(MeshOutputModes.IsEmpty() ? (bIsMainGeoEditable ? HAPI_UNREAL_OUTPUT_MESH_TYPE_HOUDINIMESH : HAPI_UNREAL_OUTPUT_MESH_TYPE_STATICMESH) :
-				MeshOutputModes[MeshAttributeEntryIdx(MeshOutputModeOwner, TriIdx, HAPI_ATTROWNER_PRIM, Vertices)],
-				HAPI_UNREAL_OUTPUT_MESH_TYPE_STATICMESH, HAPI_UNREAL_OUTPUT_MESH_TYPE_HOUDINIMESH);  // We should clamp it, to ensure the mode int is limit to 0 - 2
-
-			int32 EditIdx = -1;  // -1 represents "main_geo"
-			if (bCanHaveEditableOutput)
-			{
-				for (int32 EditableGroupIdx = 0; EditableGroupIdx < EditableGroupships.Num(); ++EditableGroupIdx)
-				{
-					if (EditableGroupships[EditableGroupIdx][TriIdx])
-					{
-						EditIdx = EditableGroupIdx;
-						MeshOutputMode = HAPI_UNREAL_OUTPUT_MESH_TYPE_HOUDINIMESH;  // If this is a solver node, and in editable group, we should force it to generate houdini mesh
-						break;
-					}
-				}
-			}
-
-			// Query LodIdx or Collision group
-			int32 LodIdx = 0;  // -1 represents collision
-			for (int32 LodGroupIdx = 0; LodGroupIdx < LodGroupships.Num(); ++LodGroupIdx)
-			{
-				if (LodGroupships[LodGroupIdx][TriIdx])
-				{
-					LodIdx = LodGroupIdx + 1;  // LodGroupships starts from "lod_1"
-					break;
-				}
-			}
-
-			if (LodIdx == 0)  // Means this face is not in any LOD Group
-			{
-				if (CollisionGroupship.IsValidIndex(TriIdx) && CollisionGroupship[TriIdx])
-					LodIdx = -1;  // -1 represents collision
-			}
-
-
-			if (MeshOutputMode == HAPI_UNREAL_OUTPUT_MESH_TYPE_DYNAMICMESH)
-			{
-				if (LodIdx >= 1)  // DynamicMesh does NOT support LODs
-					continue;
-			}
-			else if (MeshOutputMode == HAPI_UNREAL_OUTPUT_MESH_TYPE_HOUDINIMESH)  // HAPI_MESH_OUTPUT_MODE_HOUDINIMESH
-			{
-				if (LodIdx != 0)  // HoudiniMesh does NOT support LODs and collision
-					continue;
-			}
+			const int8& MeshOutputMode = TriModes[TriIdx].Value;
+			if (MeshOutputMode == INDEX_NONE)
+				continue;
 
 			// Finally, add triangle index to the specify group
-			const TPair<int8, int32> GroupIdentifier(MeshOutputMode, MeshOutputMode == HAPI_UNREAL_OUTPUT_MESH_TYPE_HOUDINIMESH ? EditIdx : LodIdx);
+			const TPair<int8, int32> GroupIdentifier(MeshOutputMode, TriGroupIdcs[TriIdx]);
 			if (bHasSplitValues)  // Split mesh by SplitValueSHs
 			{
 				if (!FoundHolderPtr)
@@ -661,7 +700,18 @@ bool UHoudiniOutputMesh::HapiUpdate(const HAPI_GeoInfo& GeoInfo, const TArray<HA
 
 		if (!bHasSplitValues)
 			SplitMap.Add(0, AllMesh);  // We just add AllLodTrianglesMap to SplitMeshMap
-	}
+
+		// Classification data is no longer needed
+		Part.EditableGroupships.Empty();
+		Part.CollisionGroupship.Empty();
+		Part.LodGroupships.Empty();
+		Part.MeshOutputModes.Empty();
+		Part.SplitKeys.Empty();
+		Part.PartialOutputModes.Empty();
+	});
+
+	for (const FHoudiniMeshPart& Part : Parts)
+		bPartialUpdate |= Part.bPartialUpdate;
 
 
 	// -------- Update output holders --------
@@ -729,36 +779,48 @@ bool UHoudiniOutputMesh::HapiUpdate(const HAPI_GeoInfo& GeoInfo, const TArray<HA
 		const TArray<int32>& Vertices = Part.Vertices;
 
 		// -------- Retrieve mesh data --------
-		TArray<float> PositionData;
-		PositionData.SetNumUninitialized(PartInfo.pointCount * 3);
+		FHoudiniAttributeFetchPlanner AttribFetcher(NodeId, PartInfo, AttribNames);
+		AttribFetcher.RequestFloat(HAPI_ATTRIB_POSITION, 3, HAPI_ATTROWNER_POINT);
+		AttribFetcher.RequestFloat(HAPI_ATTRIB_NORMAL, 3);
+		AttribFetcher.RequestFloat(HAPI_ATTRIB_COLOR, 3);
+		AttribFetcher.RequestFloat(HAPI_ALPHA, 1);
+		AttribFetcher.RequestString(HAPI_ATTRIB_UNREAL_OBJECT_PATH);
+		AttribFetcher.RequestEnum(HAPI_ATTRIB_UNREAL_NANITE_ENABLED);
+		AttribFetcher.RequestEnum(HAPI_ATTRIB_UNREAL_SPLIT_ACTORS);
+		HOUDINI_FAIL_RETURN(AttribFetcher.HapiFetch());
+
+		// Must have "N", then we could have "tangentu", and must have "tangentu", then we could have "tangentv".
+		// All requests must be made before getting any data reference below
+		HAPI_AttributeOwner NormalOwner;
+		if (!AttribFetcher.GetFloatData(HAPI_ATTRIB_NORMAL, 3, NormalOwner).IsEmpty())
+		{
+			AttribFetcher.RequestFloat(HAPI_ATTRIB_TANGENT, 3);
+			HOUDINI_FAIL_RETURN(AttribFetcher.HapiFetch());
 
-		HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetAttributeInfo(FHoudiniEngine::Get().GetSession(), NodeId, PartId,
-			HAPI_ATTRIB_POSITION, HAPI_ATTROWNER_POINT, &AttribInfo));
+			HAPI_AttributeOwner TangentUOwner;
+			if (!AttribFetcher.GetFloatData(HAPI_ATTRIB_TANGENT, 3, TangentUOwner).IsEmpty())
+			{
+				AttribFetcher.RequestFloat(HAPI_ATTRIB_TANGENT2, 3);
+				HOUDINI_FAIL_RETURN(AttribFetcher.HapiFetch());
+			}
+		}
 
-		HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetAttributeFloatData(FHoudiniEngine::Get().GetSession(), NodeId, PartId,
-			HAPI_ATTRIB_POSITION, &AttribInfo, -1, PositionData.GetData(), 0, PartInfo.pointCount));
+		HAPI_AttributeOwner PositionOwner;
+		const TArray<float>& PositionData = AttribFetcher.GetFloatData(HAPI_ATTRIB_POSITION, 3, PositionOwner);
 
-		HAPI_AttributeOwner NormalOwner = FHoudiniEngineUtils::QueryAttributeOwner(AttribNames, PartInfo.attributeCounts, HAPI_ATTRIB_NORMAL);
-		TArray<float> NormalData;
-		HOUDINI_FAIL_RETURN(FHoudiniEngineUtils::HapiGetFloatAttributeData(NodeId, PartId, HAPI_ATTRIB_NORMAL, 3, NormalData, NormalOwner));
+		const TArray<float>& NormalData = AttribFetcher.GetFloatData(HAPI_ATTRIB_NORMAL, 3, NormalOwner);
 
-		HAPI_AttributeOwner TangentUOwner = NormalData.IsEmpty() ? HAPI_ATTROWNER_INVALID :  // Must have "N", then we could have "tangentu"
-			FHoudiniEngineUtils::QueryAttributeOwner(AttribNames, PartInfo.attributeCounts, HAPI_ATTRIB_TANGENT);
-		TArray<float> TangentUData;
-		HOUDINI_FAIL_RETURN(FHoudiniEngineUtils::HapiGetFloatAttributeData(NodeId, PartId, HAPI_ATTRIB_TANGENT, 3, TangentUData, TangentUOwner));
+		HAPI_AttributeOwner TangentUOwner;
+		const TArray<float>& TangentUData = AttribFetcher.GetFloatData(HAPI_ATTRIB_TANGENT, 3, TangentUOwner);  // Empty if NOT requested
 
-		HAPI_AttributeOwner TangentVOwner = TangentUData.IsEmpty() ? HAPI_ATTROWNER_INVALID :  // Must have "N" and "tangentu", then we could have "tangentv"
-			FHoudiniEngineUtils::QueryAttributeOwner(AttribNames, PartInfo.attributeCounts, HAPI_ATTRIB_TANGENT2);
-		TArray<float> TangentVData;
-		HOUDINI_FAIL_RETURN(FHoudiniEngineUtils::HapiGetFloatAttributeData(NodeId, PartId, HAPI_ATTRIB_TANGENT2, 3, TangentVData, TangentVOwner));
+		HAPI_AttributeOwner TangentVOwner;
+		const TArray<float>& TangentVData = AttribFetcher.GetFloatData(HAPI_ATTRIB_TANGENT2, 3, TangentVOwner);
 
-		HAPI_AttributeOwner ColorOwner = FHoudiniEngineUtils::QueryAttributeOwner(AttribNames, PartInfo.attributeCounts, HAPI_ATTRIB_COLOR);
-		TArray<float> ColorData;
-		HOUDINI_FAIL_RETURN(FHoudiniEngineUtils::HapiGetFloatAttributeData(NodeId, PartId, HAPI_ATTRIB_COLOR, 3, ColorData, ColorOwner));
+		HAPI_AttributeOwner ColorOwner;
+		const TArray<float>& ColorData = AttribFetcher.GetFloatData(HAPI_ATTRIB_COLOR, 3, ColorOwner);
 
-		HAPI_AttributeOwner AlphaOwner = FHoudiniEngineUtils::QueryAttributeOwner(AttribNames, PartInfo.attributeCounts, HAPI_ALPHA);
-		TArray<float> AlphaData;
-		HOUDINI_FAIL_RETURN(FHoudiniEngineUtils::HapiGetFloatAttributeData(NodeId, PartId, HAPI_ALPHA, 1, AlphaData, AlphaOwner));
+		HAPI_AttributeOwner AlphaOwner;
+		const TArray<float>& AlphaData = AttribFetcher.GetFloatData(HAPI_ALPHA, 1, AlphaOwner);
 		
 		const bool bHasColorAttrib = !ColorData.IsEmpty() || !AlphaData.IsEmpty();
 
@@ -776,42 +838,18 @@ bool UHoudiniOutputMesh::HapiUpdate(const HAPI_GeoInfo& GeoInfo, const TArray<HA
 			Mats, MatOwner, Vertices, NodeId, PartInfo, AttribNames));
 
 		// StaticMesh asset path
-		HAPI_AttributeOwner ObjectPathOwner = FHoudiniEngineUtils::QueryAttributeOwner(AttribNames, PartInfo.attributeCounts, HAPI_ATTRIB_UNREAL_OBJECT_PATH);
-		TArray<HAPI_StringHandle> ObjectPathSHs;
-		TMap<HAPI_StringHandle, FString> SHObjectPathMap;
-		if (ObjectPathOwner != HAPI_ATTROWNER_INVALID)
-		{
-			HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetAttributeInfo(FHoudiniEngine::Get().GetSession(), NodeId, PartId,
-				HAPI_ATTRIB_UNREAL_OBJECT_PATH, ObjectPathOwner, &AttribInfo));
-
-			if (AttribInfo.storage == HAPI_STORAGETYPE_STRING)
-			{
-				ObjectPathSHs.SetNumUninitialized(AttribInfo.count);
-				HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetAttributeStringData(FHoudiniEngine::Get().GetSession(), NodeId, PartId,
-					HAPI_ATTRIB_UNREAL_OBJECT_PATH, &AttribInfo, ObjectPathSHs.GetData(), 0, AttribInfo.count));
-				const TArray<HAPI_StringHandle> UniqueObjectPathSHs = TSet<HAPI_StringHandle>(ObjectPathSHs).Array();
-				TArray<FString> UniqueObjectPaths;
-				HOUDINI_FAIL_RETURN(FHoudiniEngineUtils::HapiConvertUniqueStringHandles(UniqueObjectPathSHs, UniqueObjectPaths));
-				for (int32 UniqueIdx = 0; UniqueIdx < UniqueObjectPathSHs.Num(); ++UniqueIdx)
-					SHObjectPathMap.Add(UniqueObjectPathSHs[UniqueIdx], UniqueObjectPaths[UniqueIdx]);
-			}
-			else
-				ObjectPathOwner = HAPI_ATTROWNER_INVALID;
-		}
+		HAPI_AttributeOwner ObjectPathOwner;
+		const TArray<HAPI_StringHandle>& ObjectPathSHs = AttribFetcher.GetStringHandles(HAPI_ATTRIB_UNREAL_OBJECT_PATH, ObjectPathOwner);
 
 
 		// -------- Static Mesh Attributes ---------
-		HAPI_AttributeOwner NaniteEnableOwner = FHoudiniEngineUtils::QueryAttributeOwner(AttribNames, PartInfo.attributeCounts, HAPI_ATTRIB_UNREAL_NANITE_ENABLED);
-		TArray<int8> bNaniteEnables;
-		HOUDINI_FAIL_RETURN(FHoudiniEngineUtils::HapiGetEnumAttributeData(NodeId, PartId, HAPI_ATTRIB_UNREAL_NANITE_ENABLED,
-			bNaniteEnables, NaniteEnableOwner));
+		HAPI_AttributeOwner NaniteEnableOwner;
+		const TArray<int8>& bNaniteEnables = AttribFetcher.GetEnumData(HAPI_ATTRIB_UNREAL_NANITE_ENABLED, NaniteEnableOwner);
 
 
 		// -------- Common Attributes --------
-		HAPI_AttributeOwner SplitActorsOwner = FHoudiniEngineUtils::QueryAttributeOwner(AttribNames, PartInfo.attributeCounts, HAPI_ATTRIB_UNREAL_SPLIT_ACTORS);
-		TArray<int8> bSplitActors;
-		HOUDINI_FAIL_RETURN(FHoudiniEngineUtils::HapiGetEnumAttributeData(NodeId, PartId, HAPI_ATTRIB_UNREAL_SPLIT_ACTORS,
-			bSplitActors, SplitActorsOwner));
+		HAPI_AttributeOwner SplitActorsOwner;
+		const TArray<int8>& bSplitActors = AttribFetcher.GetEnumData(HAPI_ATTRIB_UNREAL_SPLIT_ACTORS, SplitActorsOwner);
 
 		// Retrieve UProperties
 		TArray<TSharedPtr<FHoudiniAttribute>> PropAttribs;
@@ -879,7 +917,7 @@ bool UHoudiniOutputMesh::HapiUpdate(const HAPI_GeoInfo& GeoInfo, const TArray<HA
 				{
 					// Use the first triangle's s@unreal_object_path
 					const int32 ObjectPathDataIdx = MeshAttributeEntryIdx(ObjectPathOwner, MainTriangleIdx, HAPI_ATTROWNER_PRIM, Vertices);
-					MainStaticMeshPath = SHObjectPathMap[ObjectPathSHs[ObjectPathDataIdx]];
+					MainStaticMeshPath = AttribFetcher.GetString(ObjectPathSHs[ObjectPathDataIdx]);
 				}
 
 				if (!IS_ASSET_PATH_INVALID(MainStaticMeshPath))
@@ -1109,7 +1147,7 @@ bool UHoudiniOutputMesh::HapiUpdate(const HAPI_GeoInfo& GeoInfo, const TArray<HA
 						{
 							// use this triangle's s@unreal_object_path
 							const int32 ObjectPathDataIdx = MeshAttributeEntryIdx(ObjectPathOwner, CollisionTriangleIdx, HAPI_ATTROWNER_VERTEX, Vertices);
-							CollisionStaticMeshPath = SHObjectPathMap[ObjectPathSHs[ObjectPathDataIdx]];
+							CollisionStaticMeshPath = AttribFetcher.GetString(ObjectPathSHs[ObjectPathDataIdx]);
 						}
 						else
 							CollisionStaticMeshPath = MainStaticMeshPath;
@@ -1920,6 +1958,25 @@ void UHoudiniMeshComponent::SaveToStaticMesh(UStaticMesh* SM) const
 
 
 // Skeletal Mesh Output
+bool FHoudiniSkeletalMeshOutputBuilder::GetClaimRules(TArray<FHoudiniOutputClaimRule>& OutRules) const
+{
+	// Skinned mesh
+	FHoudiniOutputClaimRule& MeshRule = OutRules.AddDefaulted_GetRef();
+	MeshRule.PartTypeMask = (1u << HAPI_PARTTYPE_MESH);
+	MeshRule.GeometryFilter = EHoudiniPartGeometryFilter::Faces;
+	MeshRule.RequiredAttribs.Add({ HAPI_ATTRIB_BONE_CAPTURE_INDEX, EHoudiniAttributeOwner::Point });
+	MeshRule.RequiredAttribs.Add({ HAPI_ATTRIB_BONE_CAPTURE_DATA, EHoudiniAttributeOwner::Point });
+	MeshRule.bFinal = false;  // Need to check bone capture attribute storages
+
+	// Skeleton
+	FHoudiniOutputClaimRule& SkeletonRule = OutRules.AddDefaulted_GetRef();
+	SkeletonRule.PartTypeMask = (1u << HAPI_PARTTYPE_CURVE);
+	SkeletonRule.RequiredAttribs.Add({ HAPI_ATTRIB_NAME, EHoudiniAttributeOwner::Point });
+	SkeletonRule.RequiredAttribs.Add({ HAPI_ATTRIB_TRANSFORM, EHoudiniAttributeOwner::Point });
+	SkeletonRule.bFinal = false;  // Need to check segments, attribute storages and curve type
+	return true;
+}
+
 bool FHoudiniSkeletalMeshOutputBuilder::HapiIsPartValid(const int32& NodeId, const HAPI_PartInfo& PartInfo, bool& bOutIsValid, bool& bOutShouldHoldByOutput)
 {
 	bOutShouldHoldByOutput = false;
@@ -2286,36 +2343,45 @@ bool FHoudiniSkeletalMeshOutputBuilder::HapiRetrieve(AHoudiniNode* Node, const F
 				Vertices.GetData(), 0, PartInfo.vertexCount));
 			
 			// -------- Retrieve mesh data --------
-			TArray<float> PositionData;
-			PositionData.SetNumUninitialized(PartInfo.pointCount * 3);
+			FHoudiniAttributeFetchPlanner AttribFetcher(NodeId, PartInfo, AttribNames);
+			AttribFetcher.RequestFloat(HAPI_ATTRIB_POSITION, 3, HAPI_ATTROWNER_POINT);
+			AttribFetcher.RequestFloat(HAPI_ATTRIB_NORMAL, 3);
+			AttribFetcher.RequestFloat(HAPI_ATTRIB_COLOR, 3);
+			AttribFetcher.RequestFloat(HAPI_ALPHA, 1);
+			HOUDINI_FAIL_RETURN(AttribFetcher.HapiFetch());
+
+			// Must have "N", then we could have "tangentu", and must have "tangentu", then we could have "tangentv".
+			// All requests must be made before getting any data reference below
+			HAPI_AttributeOwner NormalOwner;
+			if (!AttribFetcher.GetFloatData(HAPI_ATTRIB_NORMAL, 3, NormalOwner).IsEmpty())
+			{
+				AttribFetcher.RequestFloat(HAPI_ATTRIB_TANGENT, 3);
+				HOUDINI_FAIL_RETURN(AttribFetcher.HapiFetch());
 
-			HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetAttributeInfo(FHoudiniEngine::Get().GetSession(), NodeId, PartId,
-				HAPI_ATTRIB_POSITION, HAPI_ATTROWNER_POINT, &AttribInfo));
+				HAPI_AttributeOwner TangentUOwner;
+				if (!AttribFetcher.GetFloatData(HAPI_ATTRIB_TANGENT, 3, TangentUOwner).IsEmpty())
+				{
+					AttribFetcher.RequestFloat(HAPI_ATTRIB_TANGENT2, 3);
+					HOUDINI_FAIL_RETURN(AttribFetcher.HapiFetch());
+				}
+			}
 
-			HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetAttributeFloatData(FHoudiniEngine::Get().GetSession(), NodeId, PartId,
-				HAPI_ATTRIB_POSITION, &AttribInfo, -1, PositionData.GetData(), 0, PartInfo.pointCount));
+			HAPI_AttributeOwner PositionOwner;
+			const TArray<float>& PositionData = AttribFetcher.GetFloatData(HAPI_ATTRIB_POSITION, 3, PositionOwner);
 
-			HAPI_AttributeOwner NormalOwner = FHoudiniEngineUtils::QueryAttributeOwner(AttribNames, PartInfo.attributeCounts, HAPI_ATTRIB_NORMAL);
-			TArray<float> NormalData;
-			HOUDINI_FAIL_RETURN(FHoudiniEngineUtils::HapiGetFloatAttributeData(NodeId, PartId, HAPI_ATTRIB_NORMAL, 3, NormalData, NormalOwner));
+			const TArray<float>& NormalData = AttribFetcher.GetFloatData(HAPI_ATTRIB_NORMAL, 3, NormalOwner);
 
-			HAPI_AttributeOwner TangentUOwner = NormalData.IsEmpty() ? HAPI_ATTROWNER_INVALID :  // Must have "N", then we could have "tangentu"
-				FHoudiniEngineUtils::QueryAttributeOwner(AttribNames, PartInfo.attributeCounts, HAPI_ATTRIB_TANGENT);
-			TArray<float> TangentUData;
-			HOUDINI_FAIL_RETURN(FHoudiniEngineUtils::HapiGetFloatAttributeData(NodeId, PartId, HAPI_ATTRIB_TANGENT, 3, TangentUData, TangentUOwner));
+			HAPI_AttributeOwner TangentUOwner;
+			const TArray<float>& TangentUData = AttribFetcher.GetFloatData(HAPI_ATTRIB_TANGENT, 3, TangentUOwner);  // Empty if NOT requested
 
-			HAPI_AttributeOwner TangentVOwner = TangentUData.IsEmpty() ? HAPI_ATTROWNER_INVALID :  // Must have "N" and "tangentu", then we could have "tangentv"
-				FHoudiniEngineUtils::QueryAttributeOwner(AttribNames, PartInfo.attributeCounts, HAPI_ATTRIB_TANGENT2);
-			TArray<float> TangentVData;
-			HOUDINI_FAIL_RETURN(FHoudiniEngineUtils::HapiGetFloatAttributeData(NodeId, PartId, HAPI_ATTRIB_TANGENT2, 3, TangentVData, TangentVOwner));
+			HAPI_AttributeOwner TangentVOwner;
+			const TArray<float>& TangentVData = AttribFetcher.GetFloatData(HAPI_ATTRIB_TANGENT2, 3, TangentVOwner);
 
-			HAPI_AttributeOwner ColorOwner = FHoudiniEngineUtils::QueryAttributeOwner(AttribNames, PartInfo.attributeCounts, HAPI_ATTRIB_COLOR);
-			TArray<float> ColorData;
-			HOUDINI_FAIL_RETURN(FHoudiniEngineUtils::HapiGetFloatAttributeData(NodeId, PartId, HAPI_ATTRIB_COLOR, 3, ColorData, ColorOwner));
+			HAPI_AttributeOwner ColorOwner;
+			const TArray<float>& ColorData = AttribFetcher.GetFloatData(HAPI_ATTRIB_COLOR, 3, ColorOwner);
 
-			HAPI_AttributeOwner AlphaOwner = FHoudiniEngineUtils::QueryAttributeOwner(AttribNames, PartInfo.attributeCounts, HAPI_ALPHA);
-			TArray<float> AlphaData;
-			HOUDINI_FAIL_RETURN(FHoudiniEngineUtils::HapiGetFloatAttributeData(NodeId, PartId, HAPI_ALPHA, 1, AlphaData, AlphaOwner));
+			HAPI_AttributeOwner AlphaOwner;
+			const TArray<float>& AlphaData = AttribFetcher.GetFloatData(HAPI_ALPHA, 1, AlphaOwner);
 
 			const bool bHasColorAttrib = !ColorData.IsEmpty() || !AlphaData.IsEmpty();
 
@@ -5,6 +5,7 @@
 
 #include "SparseVolumeTexture/SparseVolumeTexture.h"
 #include "SparseVolumeTexture/SparseVolumeTextureData.h"
+#include "Tasks/Task.h"
 
 #include "HAPI/HAPI_Version.h"
 #include "HoudiniApi.h"
@@ -19,6 +20,13 @@
 //#include "F:\UnrealEngine\Engine\Plugins\Experimental\GeometryScripting\Source\GeometryScriptingEditor\Private\EditorTextureMapFunctions.cpp"
 
 
+bool FHoudiniTextureOutputBuilder::GetClaimRule(FHoudiniOutputClaimRule& OutRule) const
+{
+	OutRule.PartTypeMask = (1u << HAPI_PARTTYPE_VOLUME);
+	OutRule.bFinal = false;  // Need to check volume type, which could NOT be told by attribute names, so volumes are never cached by classifier
+	return true;
+}
+
 bool FHoudiniTextureOutputBuilder::HapiIsPartValid(const int32& NodeId, const HAPI_PartInfo& PartInfo, bool& bOutIsValid, bool& bOutShouldHoldByOutput)
 {
 	bOutIsValid = false;
@@ -180,56 +188,163 @@ bool HapiGetVolumeStorageType(const int32& NodeId, const int32& PartId, EHoudini
 	return true;
 }
 
+static bool IsVDBVoxelTransformEqual(const HAPI_Transform& A, const HAPI_Transform& B)  // Compare voxel size and orientation, position is NOT compared
+{
+	for (int32 Axis = 0; Axis < HAPI_SCALE_VECTOR_SIZE; ++Axis)
+	{
+		if (!FMath::IsNearlyEqual(A.scale[Axis], B.scale[Axis], FMath::Max(FMath::Abs(A.scale[Axis]), FMath::Abs(B.scale[Axis])) * 1e-4f))
+			return false;
+	}
+
+	return FQuat4f(A.rotationQuaternion[0], A.rotationQuaternion[1], A.rotationQuaternion[2], A.rotationQuaternion[3]).Equals(
+		FQuat4f(B.rotationQuaternion[0], B.rotationQuaternion[1], B.rotationQuaternion[2], B.rotationQuaternion[3]), 1e-4f);
+}
+
 
+// A frame of sparse volume texture, may consist of several VDBs packed into attributes channels (e.g. density, temperature, vel)
 class FHoudiniSparseVolumeDataProvider : public UE::SVT::ITextureDataProvider
 {
 public:
-	bool HapiInitialize(const int32& NodeId, const int32& PartId, const HAPI_VolumeInfo& VolumeInfo, const EHoudiniVolumeConvertDataType& TextureStorage)
+	struct FHoudiniVDBChannels  // Where a VDB should be packed to
 	{
-		TupleSize = VolumeInfo.tupleSize;
-		TileSize = VolumeInfo.tileSize;
+		int32 AttributesIdx = 0;  // 0 is AttributesA, 1 is AttributesB
+
+		int32 ComponentOffset = 0;
+	};
+
+protected:
+	struct FHoudiniVDBTiles  // Active tiles of a single VDB
+	{
+		FHoudiniVDBChannels Channels;
+
+		int32 TupleSize = 0;
+
+		int32 TileSize = 0;
+
+		FIntVector VolumeMax;  // Relative to FrameMin
+
+		TArray<FIntVector> TileMins;  // Relative to FrameMin
+
+		TArray<float> TileData;  // TileSize^3 * TupleSize floats per tile, in the same order as TileMins
+
+		TArray<TArray<int32>> TileActiveVoxelIndices;  // Indices of non-empty voxels in each tile
+	};
+
+	TArray<FHoudiniVDBTiles> VDBs;
+
+	UE::SVT::FTextureDataCreateInfo CreateInfo;
+
+	FIntVector FrameMin = FIntVector::ZeroValue;
+
+public:
+	FORCEINLINE const FIntVector& GetFrameMin() const { return FrameMin; }
+
+	// Only fetch data by HAPI, so that we could fetch the next frame while this frame is being converted by ConvertTiles and FTextureData::Create
+	// NumComponents should be computed from all VDBs of the SVT rather than this frame, as all frames of an animated SVT must share the same formats
+	bool HapiInitialize(const int32& NodeId, const TArray<TPair<int32, HAPI_VolumeInfo>>& PartVolumeInfos, const TArray<FHoudiniVDBChannels>& VDBChannels,
+		const int32 (&NumComponents)[2], const EHoudiniVolumeConvertDataType& TextureStorage)
+	{
+		// Min should always >= 0, otherwise data won't import, see UStreamableSparseVolumeTexture::AppendFrame, so we need the min of all VDBs
+		FIntVector FrameMax(TNumericLimits<int32>::Lowest());
+		FrameMin = FIntVector(TNumericLimits<int32>::Max());
+		for (const TPair<int32, HAPI_VolumeInfo>& PartVolumeInfo : PartVolumeInfos)
+		{
+			const HAPI_VolumeInfo& VolumeInfo = PartVolumeInfo.Value;
+			FrameMin = FIntVector(FMath::Min(FrameMin.X, VolumeInfo.minX), FMath::Min(FrameMin.Y, VolumeInfo.minY), FMath::Min(FrameMin.Z, VolumeInfo.minZ));
+			FrameMax = FIntVector(FMath::Max(FrameMax.X, VolumeInfo.minX + VolumeInfo.xLength),
+				FMath::Max(FrameMax.Y, VolumeInfo.minY + VolumeInfo.yLength), FMath::Max(FrameMax.Z, VolumeInfo.minZ + VolumeInfo.zLength));
+		}
 
-		// Min should always >= 0, otherwise data won't import, see UStreamableSparseVolumeTexture::AppendFrame
 		CreateInfo.VirtualVolumeAABBMin.X = 0;
 		CreateInfo.VirtualVolumeAABBMin.Y = 0;
 		CreateInfo.VirtualVolumeAABBMin.Z = 0;
-		CreateInfo.VirtualVolumeAABBMax.X = VolumeInfo.xLength;
-		CreateInfo.VirtualVolumeAABBMax.Y = VolumeInfo.yLength;
-		CreateInfo.VirtualVolumeAABBMax.Z = VolumeInfo.zLength;
+		CreateInfo.VirtualVolumeAABBMax.X = FrameMax.X - FrameMin.X;
+		CreateInfo.VirtualVolumeAABBMax.Y = FrameMax.Y - FrameMin.Y;
+		CreateInfo.VirtualVolumeAABBMax.Z = FrameMax.Z - FrameMin.Z;
 
-		CreateInfo.AttributesFormats[0] = PF_R8G8B8A8;
-		ETextureSourceFormat TextureFormat = TSF_BGRA8;
-		VolumeConvertInfoToTextureFormats(TextureStorage, VolumeInfo.tupleSize, CreateInfo.AttributesFormats[0], TextureFormat);
+		for (int32 AttributesIdx = 0; AttributesIdx < 2; ++AttributesIdx)
+		{
+			if (NumComponents[AttributesIdx] <= 0)
+				continue;
 
-		TArray<float> TileData;
-		TileData.SetNumUninitialized(VolumeInfo.tileSize * VolumeInfo.tileSize * VolumeInfo.tileSize * VolumeInfo.tupleSize);
+			CreateInfo.AttributesFormats[AttributesIdx] = PF_R8G8B8A8;
+			ETextureSourceFormat TextureFormat = TSF_BGRA8;
+			VolumeConvertInfoToTextureFormats(TextureStorage, NumComponents[AttributesIdx], CreateInfo.AttributesFormats[AttributesIdx], TextureFormat);
+		}
 
-		HAPI_VolumeTileInfo TileInfo;
-		HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetFirstVolumeTile(FHoudiniEngine::Get().GetSession(), NodeId, PartId, &TileInfo));
-		for (;;)
+		// -------- Fetch all active tiles of each VDB into a single contiguous buffer --------
+		// HAPI has NO bulk transport for VDB tiles, but we could at least avoid per-tile allocations and zero-fills,
+		// as GetVolumeTileFloatData will write the whole tile, and pad voxels out of volume by fill_value
+		for (int32 VDBIdx = 0; VDBIdx < PartVolumeInfos.Num(); ++VDBIdx)
 		{
-			if (!TileInfo.isValid)
-				break;
-
-			FMemory::Memzero(TileData.GetData(), TileData.Num() * sizeof(float));
+			const int32& PartId = PartVolumeInfos[VDBIdx].Key;
+			const HAPI_VolumeInfo& VolumeInfo = PartVolumeInfos[VDBIdx].Value;
+
+			FHoudiniVDBTiles& VDB = VDBs.AddDefaulted_GetRef();
+			VDB.Channels = VDBChannels[VDBIdx];
+			VDB.TupleSize = VolumeInfo.tupleSize;
+			VDB.TileSize = VolumeInfo.tileSize;
+			VDB.VolumeMax = FIntVector(VolumeInfo.minX + VolumeInfo.xLength, VolumeInfo.minY + VolumeInfo.yLength, VolumeInfo.minZ + VolumeInfo.zLength) - FrameMin;
+
+			const int32 TileLength = VDB.TileSize * VDB.TileSize * VDB.TileSize * VDB.TupleSize;
+			HAPI_VolumeTileInfo TileInfo;
+			HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetFirstVolumeTile(FHoudiniEngine::Get().GetSession(), NodeId, PartId, &TileInfo));
+			while (TileInfo.isValid)
+			{
+				const int32 TileIdx = VDB.TileMins.Num();
+				if (VDB.TileData.Num() < (TileIdx + 1) * TileLength)
+					VDB.TileData.SetNumUninitialized(FMath::Max(VDB.TileData.Num() * 2, (TileIdx + 1) * TileLength));
 
-			// Get the color data.
-			HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetVolumeTileFloatData(FHoudiniEngine::Get().GetSession(),
-				NodeId, PartId, 0.0f, &TileInfo, TileData.GetData(), TileData.Num()));
+				HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetVolumeTileFloatData(FHoudiniEngine::Get().GetSession(),
+					NodeId, PartId, 0.0f, &TileInfo, VDB.TileData.GetData() + TileIdx * TileLength, TileLength));
 
-			Tiles.Emplace(FIntVector(TileInfo.minX - VolumeInfo.minX, TileInfo.minY - VolumeInfo.minY, TileInfo.minZ - VolumeInfo.minZ), TileData);  // Min should always >= 0, otherwise data won't import, see UStreamableSparseVolumeTexture::AppendFrame
+				VDB.TileMins.Emplace(TileInfo.minX - FrameMin.X, TileInfo.minY - FrameMin.Y, TileInfo.minZ - FrameMin.Z);
 
-			HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetNextVolumeTile(FHoudiniEngine::Get().GetSession(), NodeId, PartId, &TileInfo));
+				HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetNextVolumeTile(FHoudiniEngine::Get().GetSession(), NodeId, PartId, &TileInfo));
+			}
+			VDB.TileData.SetNum(VDB.TileMins.Num() * TileLength);
 		}
 
 		return true;
 	}
 
-	UE::SVT::FTextureDataCreateInfo CreateInfo;
-
-	int32 TupleSize = 0;
-	int32 TileSize = 0;
-	TArray<TPair<FIntVector, TArray<float>>> Tiles;
+	void ConvertTiles()  // Find out non-empty voxels of each tile in parallel, could be called on any thread
+	{
+		for (FHoudiniVDBTiles& VDB : VDBs)
+		{
+			const int32& TileSize = VDB.TileSize;
+			const int32& TupleSize = VDB.TupleSize;
+			const int32 TileLength = TileSize * TileSize * TileSize * TupleSize;
+			VDB.TileActiveVoxelIndices.SetNum(VDB.TileMins.Num());
+			ParallelFor(VDB.TileMins.Num(), [&](int32 TileIdx)
+				{
+					const FIntVector& TileMin = VDB.TileMins[TileIdx];
+					const FIntVector TileMax(FMath::Min(TileMin.X + TileSize, VDB.VolumeMax.X),
+						FMath::Min(TileMin.Y + TileSize, VDB.VolumeMax.Y), FMath::Min(TileMin.Z + TileSize, VDB.VolumeMax.Z));
+					const float* TileValues = VDB.TileData.GetData() + TileIdx * TileLength;
+					TArray<int32>& ActiveVoxelIndices = VDB.TileActiveVoxelIndices[TileIdx];
+					for (int32 Z = 0; Z < TileMax.Z - TileMin.Z; ++Z)
+					{
+						for (int32 Y = 0; Y < TileMax.Y - TileMin.Y; ++Y)
+						{
+							for (int32 X = 0; X < TileMax.X - TileMin.X; ++X)
+							{
+								const int32 TileVoxelIdx = X + Y * TileSize + Z * TileSize * TileSize;
+								const float* VoxelValues = TileValues + TileVoxelIdx * TupleSize;
+								for (int32 TupleIdx = 0; TupleIdx < TupleSize; ++TupleIdx)
+								{
+									if (VoxelValues[TupleIdx] != 0.0f)
+									{
+										ActiveVoxelIndices.Add(TileVoxelIdx);
+										break;
+									}
+								}
+							}
+						}
+					}
+				});
+		}
+	}
 
 	virtual UE::SVT::FTextureDataCreateInfo GetCreateInfo() const override
 	{
@@ -238,34 +353,22 @@ public:
 
 	virtual void IteratePhysicalSource(TFunctionRef<void(const FIntVector3& Coord, int32 AttributesIdx, int32 ComponentIdx, float VoxelValue)> OnVisit) const override
 	{
-		for (const TPair<FIntVector, TArray<float>>& Tile : Tiles)
+		// ITextureDataProvider only accepts per-voxel visits, so just walk the voxels that have been filtered by ConvertTiles
+		for (const FHoudiniVDBTiles& VDB : VDBs)
 		{
-			const FIntVector TileMax(FMath::Min(Tile.Key.X + TileSize, CreateInfo.VirtualVolumeAABBMax.X),
-				FMath::Min(Tile.Key.Y + TileSize, CreateInfo.VirtualVolumeAABBMax.Y),
-				FMath::Min(Tile.Key.Z + TileSize, CreateInfo.VirtualVolumeAABBMax.Z));
-			for (int32 X = Tile.Key.X; X < TileMax.X; ++X)
+			const int32& TileSize = VDB.TileSize;
+			const int32& TupleSize = VDB.TupleSize;
+			const int32 TileLength = TileSize * TileSize * TileSize * TupleSize;
+			for (int32 TileIdx = 0; TileIdx < VDB.TileMins.Num(); ++TileIdx)
 			{
-				for (int32 Y = Tile.Key.Y; Y < TileMax.Y; ++Y)
+				const FIntVector& TileMin = VDB.TileMins[TileIdx];
+				const float* TileValues = VDB.TileData.GetData() + TileIdx * TileLength;
+				for (const int32& TileVoxelIdx : VDB.TileActiveVoxelIndices[TileIdx])
 				{
-					for (int32 Z = Tile.Key.Z; Z < TileMax.Z; ++Z)
-					{
-						const int32 TileVoxelIdx = ((X - Tile.Key.X) + (Y - Tile.Key.Y) * TileSize + (Z - Tile.Key.Z) * TileSize * TileSize) * TupleSize;
-						bool bHasValue = false;
-						for (int32 TupleIdx = 0; TupleIdx < TupleSize; ++TupleIdx)
-						{
-							if (Tile.Value[TileVoxelIdx + TupleIdx] != 0.0f)
-							{
-								bHasValue = true;
-								break;
-							}
-						}
-
-						if (bHasValue)
-						{
-							for (int32 TupleIdx = 0; TupleIdx < TupleSize; ++TupleIdx)
-								OnVisit(FIntVector3(X, Y, Z), 0, TupleIdx, Tile.Value[TileVoxelIdx + TupleIdx]);
-						}
-					}
+					const FIntVector3 Coord(TileMin.X + TileVoxelIdx % TileSize, TileMin.Y + (TileVoxelIdx / TileSize) % TileSize, TileMin.Z + TileVoxelIdx / (TileSize * TileSize));
+					const float* VoxelValues = TileValues + TileVoxelIdx * TupleSize;
+					for (int32 TupleIdx = 0; TupleIdx < TupleSize; ++TupleIdx)
+						OnVisit(Coord, VDB.Channels.AttributesIdx, VDB.Channels.ComponentOffset + TupleIdx, VoxelValues[TupleIdx]);
 				}
 			}
 		}
@@ -278,7 +381,15 @@ bool FHoudiniTextureOutputBuilder::HapiRetrieve(AHoudiniNode* Node, const FStrin
 
 	const int32& NodeId = GeoInfo.nodeId;
 
-	TMap<FString, TArray<TPair<HAPI_PartInfo, HAPI_VolumeInfo>>> NameVDBsMap;
+	struct FHoudiniVDBDesc
+	{
+		HAPI_PartInfo PartInfo;
+		HAPI_VolumeInfo VolumeInfo;
+		FString Name;
+		int32 Frame = -1;  // -1 means use the order of VDBs that have the same name
+	};
+
+	TMap<FString, TArray<FHoudiniVDBDesc>> PathVDBsMap;  // VDBs with the same asset path will be packed into one SVT
 	for (const HAPI_PartInfo& PartInfo : PartInfos)
 	{
 		const int32& PartId = PartInfo.id;
@@ -467,11 +578,38 @@ bool FHoudiniTextureOutputBuilder::HapiRetrieve(AHoudiniNode* Node, const FStrin
 			if (VolumeInfo.storage != HAPI_STORAGETYPE_FLOAT || VolumeInfo.tupleSize > 4)
 				continue;
 
-			NameVDBsMap.FindOrAdd(Name).Emplace(PartInfo, VolumeInfo);
+			TArray<std::string> AttribNames;
+			HOUDINI_FAIL_RETURN(FHoudiniEngineUtils::HapiGetAttributeNames(
+				NodeId, PartId, PartInfo.attributeCounts, AttribNames));
+
+			FString ObjectPath;
+			HOUDINI_FAIL_RETURN(FHoudiniEngineUtils::HapiGetStringAttributeValue(NodeId, PartId,
+				AttribNames, PartInfo.attributeCounts, HAPI_ATTRIB_UNREAL_OBJECT_PATH, ObjectPath));
+
+			FHoudiniVDBDesc VDBDesc;
+			VDBDesc.PartInfo = PartInfo;
+			VDBDesc.VolumeInfo = VolumeInfo;
+			VDBDesc.Name = Name;
+
+			const HAPI_AttributeOwner FrameOwner = FHoudiniEngineUtils::QueryAttributeOwner(AttribNames, PartInfo.attributeCounts, HAPI_ATTRIB_UNREAL_SVT_FRAME);
+			if (FrameOwner != HAPI_ATTROWNER_INVALID)
+			{
+				HAPI_AttributeInfo AttribInfo;
+				HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetAttributeInfo(FHoudiniEngine::Get().GetSession(), NodeId, PartId,
+					HAPI_ATTRIB_UNREAL_SVT_FRAME, FrameOwner, &AttribInfo));
+				if (AttribInfo.storage == HAPI_STORAGETYPE_INT)
+				{
+					AttribInfo.tupleSize = 1;
+					HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetAttributeIntData(FHoudiniEngine::Get().GetSession(), NodeId, PartId,
+						HAPI_ATTRIB_UNREAL_SVT_FRAME, &AttribInfo, -1, &VDBDesc.Frame, 0, 1));
+				}
+			}
+
+			PathVDBsMap.FindOrAdd(IS_ASSET_PATH_INVALID(ObjectPath) ? Node->GetCookFolderPath() + Name : ObjectPath).Add(VDBDesc);
 		}
 	}
 
-	if (NameVDBsMap.IsEmpty())
+	if (PathVDBsMap.IsEmpty())
 		return true;
 
 	//FHoudiniEngine::Get().FinishHoudiniMainTaskMessage();  // TODO: Check whether this is needed - Avoid D3D12 invalid scissor crash
@@ -479,19 +617,16 @@ bool FHoudiniTextureOutputBuilder::HapiRetrieve(AHoudiniNode* Node, const FStrin
 	const bool bBackupIsSilent = GIsSilent;
 	GIsSilent = true;  // Disable FSlowTask::MakeDialog, (process bar) when create SVT
 
-	for (const auto& NameVDBs : NameVDBsMap)
+	for (const auto& PathVDBs : PathVDBsMap)
 	{
-		const HAPI_PartInfo& MainPartInfo = NameVDBs.Value[0].Key;
+		const TArray<FHoudiniVDBDesc>& VDBDescs = PathVDBs.Value;
+		const HAPI_PartInfo& MainPartInfo = VDBDescs[0].PartInfo;
 		const int32& MainPartId = MainPartInfo.id;
 
 		TArray<std::string> AttribNames;
 		HOUDINI_FAIL_RETURN(FHoudiniEngineUtils::HapiGetAttributeNames(NodeId, MainPartId,
 			MainPartInfo.attributeCounts, AttribNames));
 
-		FString ObjectPath;
-		HOUDINI_FAIL_RETURN(FHoudiniEngineUtils::HapiGetStringAttributeValue(NodeId, MainPartId,
-			AttribNames, MainPartInfo.attributeCounts, HAPI_ATTRIB_UNREAL_OBJECT_PATH, ObjectPath));
-
 		EHoudiniVolumeConvertDataType TextureStorage = EHoudiniVolumeConvertDataType::Uint8;
 		HOUDINI_FAIL_RETURN(HapiGetTextureStorage(NodeId, MainPartId,
 			AttribNames, MainPartInfo.attributeCounts, TextureStorage));
@@ -501,22 +636,105 @@ bool FHoudiniTextureOutputBuilder::HapiRetrieve(AHoudiniNode* Node, const FStrin
 		HOUDINI_FAIL_RETURN(FHoudiniAttribute::HapiRetrieveAttributes(NodeId, MainPartId,
 			AttribNames, MainPartInfo.attributeCounts, HAPI_ATTRIB_PREFIX_UNREAL_UPROPERTY, PropAttribs));
 
-		if (NameVDBs.Value.Num() == 1)  // Static
+		// -------- Pack VDBs with different names into attributes channels, by the order they appear --------
+		TMap<FString, FHoudiniSparseVolumeDataProvider::FHoudiniVDBChannels> NameChannelsMap;
+		// Tiles are packed by index-space coords, so all packed VDBs must share the voxel size and orientation of the first one
+		const HAPI_Transform& PackTransform = VDBDescs[0].VolumeInfo.transform;
+		TBitArray<> VDBPackables(true, VDBDescs.Num());
+		TSet<FString> MismatchedNames;
+		int32 NumComponents[2] = { 0, 0 };
+		for (int32 VDBIdx = 0; VDBIdx < VDBDescs.Num(); ++VDBIdx)
+		{
+			const FHoudiniVDBDesc& VDBDesc = VDBDescs[VDBIdx];
+			if (!IsVDBVoxelTransformEqual(VDBDesc.VolumeInfo.transform, PackTransform))
+			{
+				VDBPackables[VDBIdx] = false;
+				if (!MismatchedNames.Contains(VDBDesc.Name))
+				{
+					MismatchedNames.Add(VDBDesc.Name);
+					UE_LOG(LogHoudiniEngine, Warning, TEXT("%s: VDB \"%s\" could NOT be packed, as its voxel size or orientation differs from VDB \"%s\""),
+						*PathVDBs.Key, *VDBDesc.Name, *VDBDescs[0].Name);
+				}
+				continue;
+			}
+
+			if (NameChannelsMap.Contains(VDBDesc.Name))
+				continue;
+
+			FHoudiniSparseVolumeDataProvider::FHoudiniVDBChannels Channels;
+			Channels.AttributesIdx = (NumComponents[0] + VDBDesc.VolumeInfo.tupleSize <= 4) ? 0 :
+				((NumComponents[1] + VDBDesc.VolumeInfo.tupleSize <= 4) ? 1 : INDEX_NONE);
+			if (Channels.AttributesIdx == INDEX_NONE)
+			{
+				UE_LOG(LogHoudiniEngine, Warning, TEXT("%s: VDB \"%s\" could NOT be packed, as sparse volume texture only has 8 attributes channels"),
+					*PathVDBs.Key, *VDBDesc.Name);
+				continue;
+			}
+
+			Channels.ComponentOffset = NumComponents[Channels.AttributesIdx];
+			NumComponents[Channels.AttributesIdx] += VDBDesc.VolumeInfo.tupleSize;
+			NameChannelsMap.Add(VDBDesc.Name, Channels);
+		}
+
+		// -------- Sort VDBs to frames, by i@unreal_svt_frame, or by the order of VDBs that have the same name --------
+		TMap<int32, TArray<int32>> FrameVDBIndicesMap;
+		TMap<FString, int32> NameNumFramesMap;
+		for (int32 VDBIdx = 0; VDBIdx < VDBDescs.Num(); ++VDBIdx)
 		{
-			const HAPI_VolumeInfo& VolumeInfo = NameVDBs.Value[0].Value;
+			const FHoudiniVDBDesc& VDBDesc = VDBDescs[VDBIdx];
+			int32& NameNumFrames = NameNumFramesMap.FindOrAdd(VDBDesc.Name);
+			const int32 Frame = (VDBDesc.Frame >= 0) ? VDBDesc.Frame : NameNumFrames;
+			++NameNumFrames;
+			if (VDBPackables[VDBIdx] && NameChannelsMap.Contains(VDBDesc.Name))
+				FrameVDBIndicesMap.FindOrAdd(Frame).Add(VDBIdx);
+		}
+		FrameVDBIndicesMap.KeySort(TLess<int32>());
+
+		// -------- Pipeline frames, HAPI fetch of the next frame will overlap the conversion of the current frame --------
+		TArray<UE::SVT::FTextureData> TextureDatas;
+		TextureDatas.SetNum(FrameVDBIndicesMap.Num());
+		TArray<FTransform> Transforms;
+		Transforms.SetNum(FrameVDBIndicesMap.Num());
+		UE::Tasks::FTask ConvertTask;
+		int32 FrameIdx = 0;
+		for (const auto& FrameVDBIndices : FrameVDBIndicesMap)
+		{
+			TArray<TPair<int32, HAPI_VolumeInfo>> PartVolumeInfos;
+			TArray<FHoudiniSparseVolumeDataProvider::FHoudiniVDBChannels> VDBChannels;
+			for (const int32& VDBIdx : FrameVDBIndices.Value)
+			{
+				const FHoudiniVDBDesc& VDBDesc = VDBDescs[VDBIdx];
+				PartVolumeInfos.Emplace(VDBDesc.PartInfo.id, VDBDesc.VolumeInfo);
+				VDBChannels.Add(NameChannelsMap[VDBDesc.Name]);
+			}
 
-			UE::SVT::FTextureData TextureData{};
+			const TSharedPtr<FHoudiniSparseVolumeDataProvider> HSVDP = MakeShared<FHoudiniSparseVolumeDataProvider>();
+			if (!HSVDP->HapiInitialize(NodeId, PartVolumeInfos, VDBChannels, NumComponents, TextureStorage))
+			{
+				ConvertTask.Wait();  // TextureDatas is still referenced by the previous frame
+				GIsSilent = bBackupIsSilent;
+				return false;
+			}
 
-			FHoudiniSparseVolumeDataProvider HSVDP;
-			HOUDINI_FAIL_RETURN(HSVDP.HapiInitialize(NodeId, MainPartId, VolumeInfo, TextureStorage));
-			TextureData.Create(HSVDP);
+			Transforms[FrameIdx].SetLocation(FVector(HSVDP->GetFrameMin()));
 
-			UStaticSparseVolumeTexture* SVT = FHoudiniEngineUtils::CreateAsset<UStaticSparseVolumeTexture>(
-				IS_ASSET_PATH_INVALID(ObjectPath) ? Node->GetCookFolderPath() + NameVDBs.Key : ObjectPath);
+			ConvertTask.Wait();  // At most one frame is converting, to limit the memory of fetched tiles
+			ConvertTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [HSVDP, &TextureData = TextureDatas[FrameIdx]]
+				{
+					HSVDP->ConvertTiles();
+					TextureData.Create(*HSVDP);
+				});
+			++FrameIdx;
+		}
+		ConvertTask.Wait();
+
+		if (TextureDatas.Num() == 1)  // Static
+		{
+			UStaticSparseVolumeTexture* SVT = FHoudiniEngineUtils::CreateAsset<UStaticSparseVolumeTexture>(PathVDBs.Key);
 #if ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 4)) || (ENGINE_MAJOR_VERSION > 5)
-			SVT->Initialize(MakeArrayView(&TextureData, 1), TArray<FTransform>{FTransform::Identity});
+			SVT->Initialize(TextureDatas, TArray<FTransform>{FTransform::Identity});
 #else
-			SVT->Initialize(MakeArrayView(&TextureData, 1));
+			SVT->Initialize(TextureDatas);
 #endif
 			for (const TSharedPtr<FHoudiniAttribute>& PropAttrib : PropAttribs)
 				PropAttrib->SetObjectPropertyValues(SVT, 0);
@@ -524,28 +742,9 @@ bool FHoudiniTextureOutputBuilder::HapiRetrieve(AHoudiniNode* Node, const FStrin
 			SVT->PostEditChange();
 			SVT->Modify();
 		}
-		else  // Animated
+		else if (TextureDatas.Num() >= 2)  // Animated
 		{
-			TArray<UE::SVT::FTextureData> TextureDatas;
-			TArray<FTransform> Transforms;
-			for (const TPair<HAPI_PartInfo, HAPI_VolumeInfo>& VDB : NameVDBs.Value)
-			{
-				const HAPI_VolumeInfo& VolumeInfo = VDB.Value;
-
-				UE::SVT::FTextureData TextureData{};
-
-				FHoudiniSparseVolumeDataProvider HSVDP;
-				HOUDINI_FAIL_RETURN(HSVDP.HapiInitialize(NodeId, VDB.Key.id, VolumeInfo, TextureStorage));
-				TextureData.Create(HSVDP);
-				TextureDatas.Add(TextureData);
-
-				FTransform VDBOffset = FTransform::Identity;
-				VDBOffset.SetLocation(FVector(VolumeInfo.minX, VolumeInfo.minY, VolumeInfo.minZ));
-				Transforms.Add(VDBOffset);
-			}
-
-			UAnimatedSparseVolumeTexture* SVT = FHoudiniEngineUtils::CreateAsset<UAnimatedSparseVolumeTexture>(
-				IS_ASSET_PATH_INVALID(ObjectPath) ? Node->GetCookFolderPath() + NameVDBs.Key : ObjectPath);
+			UAnimatedSparseVolumeTexture* SVT = FHoudiniEngineUtils::CreateAsset<UAnimatedSparseVolumeTexture>(PathVDBs.Key);
 #if ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 4)) || (ENGINE_MAJOR_VERSION > 5)
 			SVT->Initialize(TextureDatas, Transforms);
 #else
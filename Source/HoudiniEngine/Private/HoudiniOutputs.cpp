@@ -15,6 +15,188 @@
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
+static EHoudiniPartGeometryFilter GetPartGeometryClass(const HAPI_PartInfo& PartInfo)
+{
+	if (PartInfo.type != HAPI_PARTTYPE_MESH)
+		return EHoudiniPartGeometryFilter::Any;
+
+	if ((PartInfo.faceCount >= 1) && (PartInfo.vertexCount >= 3))
+		return EHoudiniPartGeometryFilter::Faces;
+	else if ((PartInfo.faceCount == 0) && (PartInfo.pointCount >= 1))
+		return EHoudiniPartGeometryFilter::Points;
+
+	return EHoudiniPartGeometryFilter::Any;
+}
+
+bool FHoudiniOutputClaimRule::MatchPartInfo(const HAPI_PartInfo& PartInfo) const
+{
+	if ((PartInfo.type < 0) || !(PartTypeMask & (1u << PartInfo.type)))
+		return false;
+
+	return (GeometryFilter == EHoudiniPartGeometryFilter::Any) || (PartInfo.type != HAPI_PARTTYPE_MESH) ||
+		(GeometryFilter == GetPartGeometryClass(PartInfo));
+}
+
+bool FHoudiniOutputClaimRule::MatchAttribNames(const TArray<std::string>& AttribNames, const int* AttribCounts) const
+{
+	for (const TPair<std::string, EHoudiniAttributeOwner>& RequiredAttrib : RequiredAttribs)
+	{
+		if (!FHoudiniEngineUtils::IsAttributeExists(AttribNames, AttribCounts, RequiredAttrib.Key, (HAPI_AttributeOwner)RequiredAttrib.Value))
+			return false;
+	}
+
+	for (const TPair<std::string, EHoudiniAttributeOwner>& ExcludedAttrib : ExcludedAttribs)
+	{
+		if (FHoudiniEngineUtils::IsAttributeExists(AttribNames, AttribCounts, ExcludedAttrib.Key, (HAPI_AttributeOwner)ExcludedAttrib.Value))
+			return false;
+	}
+
+	return true;
+}
+
+FHoudiniOutputClassifier::FPartSignature::FPartSignature(const HAPI_PartInfo& PartInfo) :
+	Type(PartInfo.type), Geometry(GetPartGeometryClass(PartInfo)), bIsInstanced(PartInfo.isInstanced) {}
+
+FHoudiniOutputClassifier::FHoudiniOutputClassifier(const TArray<TSharedPtr<IHoudiniOutputBuilder>>& InOutputBuilders) :
+	OutputBuilders(InOutputBuilders)
+{
+	ClaimRules.SetNum(OutputBuilders.Num());
+	for (int32 BuilderIdx = 0; BuilderIdx < OutputBuilders.Num(); ++BuilderIdx)
+	{
+		if (!OutputBuilders[BuilderIdx]->GetClaimRules(ClaimRules[BuilderIdx]))
+			ClaimRules[BuilderIdx].Empty();
+	}
+}
+
+static uint32 HashAttribNames(const TArray<std::string>& AttribNames, const int* AttribCounts)
+{
+	uint32 Hash = 0;
+	for (int32 Owner = 0; Owner < HAPI_ATTROWNER_MAX; ++Owner)  // The same names may belong to different owners, so also combine counts
+		Hash = HashCombine(Hash, GetTypeHash(AttribCounts[Owner]));
+
+	for (const std::string& AttribName : AttribNames)
+		Hash = HashCombine(Hash, FCrc::MemCrc32(AttribName.c_str(), AttribName.length()));
+
+	return Hash;
+}
+
+bool FHoudiniOutputClassifier::HapiClassify(const int32& NodeId, const HAPI_PartInfo& PartInfo,
+	TSharedPtr<IHoudiniOutputBuilder>& OutBuilder, bool& bOutShouldHoldByOutput)
+{
+	OutBuilder.Reset();
+	bOutShouldHoldByOutput = false;
+
+	const FPartSignature Signature(PartInfo);
+	TArray<std::string> AttribNames;
+	bool bHasAttribNames = false;
+	uint32 AttribNamesHash = 0;
+	auto HapiGetAttribNamesLambda = [&]() -> bool
+		{
+			if (bHasAttribNames)
+				return true;
+
+			HOUDINI_FAIL_RETURN(FHoudiniEngineUtils::HapiGetAttributeNames(NodeId, PartInfo.id, PartInfo.attributeCounts, AttribNames));
+			AttribNamesHash = HashAttribNames(AttribNames, PartInfo.attributeCounts);
+			bHasAttribNames = true;
+			return true;
+		};
+
+	auto ApplyClassificationLambda = [&](const FClassification& Classification)
+		{
+			if (OutputBuilders.IsValidIndex(Classification.BuilderIdx))
+			{
+				OutBuilder = OutputBuilders[Classification.BuilderIdx];
+				bOutShouldHoldByOutput = Classification.bShouldHoldByOutput;
+			}
+		};
+
+	// -------- Try find classification in cache --------
+	if (const FClassificationCache* FoundCache = ClassificationCacheMap.Find(Signature))
+	{
+		if (!FoundCache->bNeedAttribNames)
+		{
+			ApplyClassificationLambda(FoundCache->Classification);
+			return true;
+		}
+
+		HOUDINI_FAIL_RETURN(HapiGetAttribNamesLambda());
+		if (const FClassification* FoundClassification = FoundCache->AttribNamesClassificationMap.Find(AttribNamesHash))
+		{
+			ApplyClassificationLambda(*FoundClassification);
+			return true;
+		}
+	}
+
+	// -------- Walk builders backwards --------
+	bool bDecidedByClaimRules = true;  // Whether we could cache this classification
+	FClassification Classification;
+	for (int32 BuilderIdx = OutputBuilders.Num() - 1; BuilderIdx >= 0; --BuilderIdx)
+	{
+		const TSharedPtr<IHoudiniOutputBuilder>& OutputBuilder = OutputBuilders[BuilderIdx];
+		const TArray<FHoudiniOutputClaimRule>& BuilderClaimRules = ClaimRules[BuilderIdx];
+		const FHoudiniOutputClaimRule* MatchedClaimRule = nullptr;
+		for (const FHoudiniOutputClaimRule& ClaimRule : BuilderClaimRules)
+		{
+			if (!ClaimRule.MatchPartInfo(PartInfo))
+				continue;
+
+			if (ClaimRule.NeedAttribNames())
+			{
+				HOUDINI_FAIL_RETURN(HapiGetAttribNamesLambda());
+				if (!ClaimRule.MatchAttribNames(AttribNames, PartInfo.attributeCounts))
+					continue;
+			}
+
+			MatchedClaimRule = &ClaimRule;
+			break;
+		}
+
+		if (!BuilderClaimRules.IsEmpty() && !MatchedClaimRule)
+			continue;  // Rejected only by claim rules, so this classification could still be cached
+
+		bool bIsValid = false;
+		bool bShouldHoldByOutput = false;
+		if (MatchedClaimRule && MatchedClaimRule->bFinal)
+		{
+			bIsValid = true;
+			bShouldHoldByOutput = MatchedClaimRule->bShouldHoldByOutput;
+		}
+		else
+		{
+			bDecidedByClaimRules = false;
+			HOUDINI_FAIL_RETURN(OutputBuilder->HapiIsPartValid(NodeId, PartInfo, bIsValid, bShouldHoldByOutput));
+		}
+
+		if (bIsValid)
+		{
+			if (bShouldHoldByOutput && !OutputBuilder->GetClass())
+			{
+				UE_LOG(LogHoudiniEngine, Error, TEXT("Please override your IHoudiniOutputBuilder::GetClass() when bShouldHoldByOutput == true"));
+				continue;  // Try other builders
+			}
+
+			Classification.BuilderIdx = BuilderIdx;
+			Classification.bShouldHoldByOutput = bShouldHoldByOutput;
+			break;
+		}
+	}
+
+	if (bDecidedByClaimRules)
+	{
+		FClassificationCache& Cache = ClassificationCacheMap.FindOrAdd(Signature);
+		Cache.bNeedAttribNames = bHasAttribNames;
+		if (bHasAttribNames)
+			Cache.AttribNamesClassificationMap.Add(AttribNamesHash, Classification);
+		else
+			Cache.Classification = Classification;
+	}
+
+	ApplyClassificationLambda(Classification);
+
+	return true;
+}
+
+
 bool AHoudiniNode::HapiUpdateOutputs(const TArray<FString>& GeoNames, const TArray<HAPI_GeoInfo>& GeoInfos, const TArray<TArray<HAPI_PartInfo>>& GeoPartInfos)
 {
 	if (GeoNames.IsEmpty())
@@ -57,6 +239,7 @@ bool AHoudiniNode::HapiUpdateOutputs(const TArray<FString>& GeoNames, const TArr
 
 	// -------- Build all outputs --------
 	const TArray<TSharedPtr<IHoudiniOutputBuilder>>& OutputBuilders = FHoudiniEngine::Get().GetOutputBuilders();
+	FHoudiniOutputClassifier OutputClassifier(OutputBuilders);
 	TArray<FHoudiniOutputDesc> OutputDescs;
 	TMap<TPair<FString, TSharedPtr<IHoudiniOutputBuilder>>, FHoudiniOutputConverter> OutputConverters;
 	for (int32 GeoIdx = 0; GeoIdx < GeoInfos.Num(); ++GeoIdx)
@@ -66,57 +249,46 @@ bool AHoudiniNode::HapiUpdateOutputs(const TArray<FString>& GeoNames, const TArr
 		const TArray<HAPI_PartInfo>& PartInfos = GeoPartInfos[GeoIdx];
 		for (const HAPI_PartInfo& PartInfo : PartInfos)
 		{
-			for (int32 BuilderIdx = OutputBuilders.Num() - 1; BuilderIdx >= 0; --BuilderIdx)
+			TSharedPtr<IHoudiniOutputBuilder> OutputBuilder;
+			bool bShouldHoldByOutput = false;
+			HOUDINI_FAIL_RETURN(OutputClassifier.HapiClassify(GeoInfo.nodeId, PartInfo, OutputBuilder, bShouldHoldByOutput));
+			if (!OutputBuilder)
+				continue;
+
+			if (bShouldHoldByOutput)
 			{
-				const TSharedPtr<IHoudiniOutputBuilder>& OutputBuilder = OutputBuilders[BuilderIdx];
-				bool bIsValid = false;
-				bool bShouldHoldByOutput = false;
-				HOUDINI_FAIL_RETURN(OutputBuilder->HapiIsPartValid(GeoInfo.nodeId, PartInfo, bIsValid, bShouldHoldByOutput))
-				if (bIsValid)
-				{
-					if (bShouldHoldByOutput)
+				const TSubclassOf<UHoudiniOutput> OutputClass = OutputBuilder->GetClass();
+				const int32 FoundOutputDescIdx = OutputDescs.IndexOfByPredicate([GeoIdx, OutputClass](const FHoudiniOutputDesc& OutputDesc)
 					{
-						const TSubclassOf<UHoudiniOutput> OutputClass = OutputBuilder->GetClass();
-						if (!OutputClass)
-						{
-							UE_LOG(LogHoudiniEngine, Error, TEXT("Please override your IHoudiniOutputBuilder::GetClass() when bShouldHoldByOutput == true"));
-							continue;  // Try other builders
-						}
-						const int32 FoundOutputDescIdx = OutputDescs.IndexOfByPredicate([GeoIdx, OutputClass](const FHoudiniOutputDesc& OutputDesc)
-							{
-								return ((OutputDesc.GeoIdx == GeoIdx) && (OutputClass == OutputDesc.Class));
-							});
-						if (OutputDescs.IsValidIndex(FoundOutputDescIdx))
-							OutputDescs[FoundOutputDescIdx].PartInfos.Add(PartInfo);
-						else
+						return ((OutputDesc.GeoIdx == GeoIdx) && (OutputClass == OutputDesc.Class));
+					});
+				if (OutputDescs.IsValidIndex(FoundOutputDescIdx))
+					OutputDescs[FoundOutputDescIdx].PartInfos.Add(PartInfo);
+				else
+				{
+					// Try find corresponding old output so that we could reuse
+					const int32 FoundOldOutputIdx = Outputs.IndexOfByPredicate([GeoName, OutputClass](const UHoudiniOutput* Output)
 						{
-							// Try find corresponding old output so that we could reuse
-							const int32 FoundOldOutputIdx = Outputs.IndexOfByPredicate([GeoName, OutputClass](const UHoudiniOutput* Output)
-								{
-									return Output->GetOutputName() == GeoName && OutputClass == Output->GetClass();
-								});
-
-							if (Outputs.IsValidIndex(FoundOldOutputIdx))
-							{
-								OutputDescs.Add(FHoudiniOutputDesc(GeoIdx, OutputClass, Outputs[FoundOldOutputIdx], PartInfo));
-								Outputs.RemoveAt(FoundOldOutputIdx);
-							}
-							else
-								OutputDescs.Add(FHoudiniOutputDesc(GeoIdx, OutputClass, nullptr, PartInfo));
-						}
-					}
-					else
+							return Output->GetOutputName() == GeoName && OutputClass == Output->GetClass();
+						});
+
+					if (Outputs.IsValidIndex(FoundOldOutputIdx))
 					{
-						const TPair<FString, TSharedPtr<IHoudiniOutputBuilder>> ConverterIdentifier(GeoName, OutputBuilder);
-						if (FHoudiniOutputConverter* ConverterPtr = OutputConverters.Find(ConverterIdentifier))
-							ConverterPtr->PartInfos.Add(PartInfo);
-						else
-							OutputConverters.Add(ConverterIdentifier, FHoudiniOutputConverter(GeoIdx, PartInfo));
+						OutputDescs.Add(FHoudiniOutputDesc(GeoIdx, OutputClass, Outputs[FoundOldOutputIdx], PartInfo));
+						Outputs.RemoveAt(FoundOldOutputIdx);
 					}
-
-					break;
+					else
+						OutputDescs.Add(FHoudiniOutputDesc(GeoIdx, OutputClass, nullptr, PartInfo));
 				}
 			}
+			else
+			{
+				const TPair<FString, TSharedPtr<IHoudiniOutputBuilder>> ConverterIdentifier(GeoName, OutputBuilder);
+				if (FHoudiniOutputConverter* ConverterPtr = OutputConverters.Find(ConverterIdentifier))
+					ConverterPtr->PartInfos.Add(PartInfo);
+				else
+					OutputConverters.Add(ConverterIdentifier, FHoudiniOutputConverter(GeoIdx, PartInfo));
+			}
 		}
 	}
 
@@ -183,7 +355,9 @@ bool AHoudiniNode::HapiUpdateOutputs(const TArray<FString>& GeoNames, const TArr
 
 	FHoudiniEngine::Get().FinishHoudiniMainTaskMessage();
 
-	UE_LOG(LogHoudiniEngine, Log, TEXT("%s: OUTPUT %.3f (s)"), *GetActorLabel(false), FPlatformTime::Seconds() - StartTime);
+	const double TimeCost = FPlatformTime::Seconds() - StartTime;
+	OutputTime += TimeCost;
+	UE_LOG(LogHoudiniEngine, Log, TEXT("%s: OUTPUT %.3f (s)"), *GetActorLabel(false), TimeCost);
 
 	return true;
 }
@@ -107,6 +107,8 @@ protected:
 	static bool GShouldRecoverMeshDistanceField;
 
 public:
+	virtual bool GetClaimRule(FHoudiniOutputClaimRule& OutRule) const override;
+
 	virtual bool HapiIsPartValid(const int32& NodeId, const HAPI_PartInfo& PartInfo, bool& bOutIsValid, bool& bOutShouldHoldByOutput) override;
 
 	virtual TSubclassOf<UHoudiniOutput> GetClass() const override { return UHoudiniOutputMesh::StaticClass(); }
@@ -119,6 +121,8 @@ public:
 class FHoudiniSkeletalMeshOutputBuilder : public IHoudiniOutputBuilder
 {
 public:
+	virtual bool GetClaimRules(TArray<FHoudiniOutputClaimRule>& OutRules) const override;
+
 	virtual bool HapiIsPartValid(const int32& NodeId, const HAPI_PartInfo& PartInfo, bool& bOutIsValid, bool& bOutShouldHoldByOutput) override;
 
 	virtual bool HapiRetrieve(AHoudiniNode* Node, const FString& OutputName, const HAPI_GeoInfo& GeoInfo, const TArray<HAPI_PartInfo>& PartInfos) override;
@@ -133,7 +137,11 @@ struct FHoudiniInstancedMeshOutput : public FHoudiniComponentOutput
 protected:
 	mutable TWeakObjectPtr<UMeshComponent> Component;
 
+	TArray<int32> InstanceIds;  // Transient, i@unreal_instance_id of each ISMC instance, so that next cook could only apply changed instances
+
 public:
+	FORCEINLINE TArray<int32>& GetInstanceIds() { return InstanceIds; }
+
 	UMeshComponent* Find(const AHoudiniNode* Node) const;
 
 	UMeshComponent* CreateOrUpdate(AHoudiniNode* Node, const TSubclassOf<UMeshComponent>& Class, const FString& InSplitValue, const bool& bSplitToActors);
@@ -299,6 +307,8 @@ public:
 class FHoudiniInstancerOutputBuilder : public IHoudiniOutputBuilder
 {
 public:
+	virtual bool GetClaimRule(FHoudiniOutputClaimRule& OutRule) const override;
+
 	virtual bool HapiIsPartValid(const int32& NodeId, const HAPI_PartInfo& PartInfo, bool& bOutIsValid, bool& bOutShouldHoldByOutput) override;
 
 	virtual TSubclassOf<UHoudiniOutput> GetClass() const override { return UHoudiniOutputInstancer::StaticClass(); }
@@ -355,6 +365,8 @@ public:
 class FHoudiniCurveOutputBuilder : public IHoudiniOutputBuilder
 {
 public:
+	virtual bool GetClaimRule(FHoudiniOutputClaimRule& OutRule) const override;
+
 	virtual bool HapiIsPartValid(const int32& NodeId, const HAPI_PartInfo& PartInfo, bool& bOutIsValid, bool& bOutShouldHoldByOutput) override;
 
 	virtual TSubclassOf<UHoudiniOutput> GetClass() const override { return UHoudiniOutputCurve::StaticClass(); }
@@ -405,6 +417,8 @@ public:
 class FHoudiniLandscapeOutputBuilder : public IHoudiniOutputBuilder
 {
 public:
+	virtual bool GetClaimRules(TArray<FHoudiniOutputClaimRule>& OutRules) const override;
+
 	virtual bool HapiIsPartValid(const int32& NodeId, const HAPI_PartInfo& PartInfo, bool& bOutIsValid, bool& bOutShouldHoldByOutput) override;
 
 	virtual TSubclassOf<UHoudiniOutput> GetClass() const override { return UHoudiniOutputLandscape::StaticClass(); }
@@ -419,6 +433,8 @@ public:
 class FHoudiniTextureOutputBuilder : public IHoudiniOutputBuilder
 {
 public:
+	virtual bool GetClaimRule(FHoudiniOutputClaimRule& OutRule) const override;
+
 	virtual bool HapiIsPartValid(const int32& NodeId, const HAPI_PartInfo& PartInfo, bool& bOutIsValid, bool& bOutShouldHoldByOutput) override;
 
 	virtual bool HapiRetrieve(AHoudiniNode* Node, const FString& OutputName, const HAPI_GeoInfo& GeoInfo, const TArray<HAPI_PartInfo>& PartInfos) override;
@@ -427,6 +443,8 @@ public:
 class FHoudiniDataTableOutputBuilder : public IHoudiniOutputBuilder
 {
 public:
+	virtual bool GetClaimRule(FHoudiniOutputClaimRule& OutRule) const override;
+
 	virtual bool HapiIsPartValid(const int32& NodeId, const HAPI_PartInfo& PartInfo, bool& bOutIsValid, bool& bOutShouldHoldByOutput) override;
 
 	virtual bool HapiRetrieve(AHoudiniNode* Node, const FString& OutputName, const HAPI_GeoInfo& GeoInfo, const TArray<HAPI_PartInfo>& PartInfos) override;
@@ -435,6 +453,8 @@ public:
 class FHoudiniMaterialInstanceOutputBuilder : public IHoudiniOutputBuilder
 {
 public:
+	virtual bool GetClaimRule(FHoudiniOutputClaimRule& OutRule) const override;
+
 	virtual bool HapiIsPartValid(const int32& NodeId, const HAPI_PartInfo& PartInfo, bool& bOutIsValid, bool& bOutShouldHoldByOutput) override;
 
 	virtual bool HapiRetrieve(AHoudiniNode* Node, const FString& OutputName, const HAPI_GeoInfo& GeoInfo, const TArray<HAPI_PartInfo>& PartInfos) override;
@@ -443,6 +463,8 @@ public:
 class FHoudiniAssetOutputBuilder : public IHoudiniOutputBuilder
 {
 public:
+	virtual bool GetClaimRule(FHoudiniOutputClaimRule& OutRule) const override;
+
 	virtual bool HapiIsPartValid(const int32& NodeId, const HAPI_PartInfo& PartInfo, bool& bOutIsValid, bool& bOutShouldHoldByOutput) override;
 
 	virtual bool HapiRetrieve(AHoudiniNode* Node, const FString& OutputName, const HAPI_GeoInfo& GeoInfo, const TArray<HAPI_PartInfo>& PartInfos) override;
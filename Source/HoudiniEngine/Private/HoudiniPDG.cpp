@@ -2,10 +2,12 @@
 
 #include "HoudiniNode.h"
 
+#include "Misc/ScopeExit.h"
 #include "Tasks/Task.h"
 
 #include "HoudiniApi.h"
 #include "HoudiniEngine.h"
+#include "HoudiniEngineSettings.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniOperatorUtils.h"
 #include "HoudiniOutput.h"
@@ -91,28 +93,22 @@ bool AHoudiniNode::HasTopNodePendingCook() const
 
 void AHoudiniNode::AsyncCookPDG()
 {
-    FHoudiniEngine::Get().StartHoudiniTask();
+    FHoudiniEngine::Get().StartHoudiniTask(this);
 
     UE::Tasks::Launch(UE_SOURCE_LOCATION, [&]
         {
+            const FHoudiniSessionScope SessionScope(this);
+
             for (FHoudiniTopNode& TopNode : TopNodes)
             {
                 if (TopNode.NeedCook())
-                {
-                    AsyncTask(ENamedThreads::GameThread, [&]
-                        {
-                            FHoudiniEngine::Get().HoudiniAsyncTaskMessageEvent.Broadcast(
-                                FText::FromString(GetActorLabel(false) + TEXT(" - PDG Cooking:\n") + TopNode.Path));
-                        });
-
-                    TopNode.HapiCook(this);
-                }
+                    TopNode.HapiCook(this);  // Will publish the cook progress by itself
             }
 
             AsyncTask(ENamedThreads::GameThread, [&]
                 {
                     this->CleanupSplitActors();
-                    FHoudiniEngine::Get().FinishHoudiniTask();
+                    FHoudiniEngine::Get().FinishHoudiniTask(this);
                     FHoudiniEngine::Get().FinishHoudiniAsyncTaskMessage();
                 });
         });
@@ -134,6 +130,57 @@ public:
     FORCEINLINE void Reset() { Name.Empty(); }
 };
 
+#define HOUDINI_PDG_EVENT_DRAIN_SIZE 1024
+#define HOUDINI_PDG_POLL_INTERVAL_MIN 0.001f
+#define HOUDINI_PDG_POLL_INTERVAL_MAX 0.1f
+#define HOUDINI_PDG_PROGRESS_INTERVAL 0.2
+
+// Work item output file that has been loaded and classified on worker, wait to be committed to outputs on game thread
+struct FHoudiniPDGOutputResult
+{
+    int32 FileNodeId = -1;  // Pooled file node, should NOT be reused until this result has been committed
+
+    FString OutputName;
+
+    HAPI_GeoInfo GeoInfo;
+
+    TArray<TPair<TSubclassOf<UHoudiniOutput>, TArray<HAPI_PartInfo>>> HeldPartInfos;  // Parts should be held by UHoudiniOutput, one output per class
+
+    TMap<TSharedPtr<IHoudiniOutputBuilder>, TArray<HAPI_PartInfo>> ConvertedPartInfos;  // Parts should be retrieved by builders directly
+};
+
+// Shared by PDG event pump (worker) and output committer (game thread ticker)
+struct FHoudiniPDGOutputIngestor
+{
+    FCriticalSection Lock;  // Guard all members below
+
+    TArray<int32> FreeFileNodeIds;
+
+    TArray<TSharedPtr<FHoudiniPDGOutputResult>> PendingResults;
+
+    int32 CommitIdx = 0;  // PendingResults before this index have been committed
+
+    bool bCommitFailed = false;  // Session has been invalidated by committer, ingestion should stop
+
+    FORCEINLINE int32 NumUncommitted() { FScopeLock ScopeLock(&Lock); return PendingResults.Num() - CommitIdx; }
+
+    FORCEINLINE bool HasCommitFailed() { FScopeLock ScopeLock(&Lock); return bCommitFailed; }
+};
+
+static int32* GetWorkItemStateCounter(FHoudiniTopNode& TopNode, const HAPI_PDG_WorkItemState& State)
+{
+    switch (State)
+    {
+    case HAPI_PDG_WORKITEM_COOKED_FAIL: return &TopNode.NumErrorWorkItems;
+    case HAPI_PDG_WORKITEM_COOKED_SUCCESS: return &TopNode.NumCompletedWorkItems;
+    case HAPI_PDG_WORKITEM_COOKING: return &TopNode.NumRunningWorkItems;
+    case HAPI_PDG_WORKITEM_WAITING: return &TopNode.NumWaitingWorkItems;
+    default: break;
+    }
+
+    return nullptr;
+}
+
 bool FHoudiniTopNode::HapiCook(AHoudiniNode* Node)
 {
     // Mark all output name empty, means pending destroy
@@ -144,58 +191,187 @@ bool FHoudiniTopNode::HapiCook(AHoudiniNode* Node)
     
     Task = EPDGTaskType::Cooking;
 
-    // While its cooking, check pdg events for each graph context,
-    // until cook has finished or errored
+    // The graph context of this TOP node will NOT change during the cook, so we just resolve it once
+    HAPI_PDG_GraphContextId ContextId = -1;
+    HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetPDGGraphContextId(FHoudiniEngine::Get().GetSession(), NodeId, &ContextId));
+    if (ContextId < 0)  // Otherwise we will poll GetPDGEvents with an invalid context until cancelled
+    {
+        Task = EPDGTaskType::None;
+        return false;
+    }
+
+    // While its cooking, pump pdg events until cook has finished or errored.
+    // Poll interval starts small and backs off while the graph is idle, so we could finish as soon as houdini does
     int32 WorkItemOutputIdx = 0;
     const bool bIsOutput = IsOutput();
 
+    ResetStates();
     TMap<HAPI_PDG_WorkItemId, HAPI_PDG_WorkItemState> WorkItemStateMap;
-    for (;;)
+    auto SetWorkItemStateLambda = [&](const HAPI_PDG_WorkItemId& WorkItemId, const HAPI_PDG_WorkItemState& NewState)
+        {
+            HAPI_PDG_WorkItemState& WorkItemState = WorkItemStateMap.FindOrAdd(WorkItemId, HAPI_PDG_WORKITEM_UNDEFINED);
+            if (int32* OldCounter = GetWorkItemStateCounter(*this, WorkItemState))
+                --(*OldCounter);
+            if (int32* NewCounter = GetWorkItemStateCounter(*this, NewState))
+                ++(*NewCounter);
+            WorkItemState = NewState;
+        };
+
+    // Publish progress to editor, at most once per HOUDINI_PDG_PROGRESS_INTERVAL
+    double LastProgressTime = 0.0;
+    auto PublishProgressLambda = [&](const bool& bForce)
+        {
+            const double CurrTime = FPlatformTime::Seconds();
+            if (!bForce && (CurrTime - LastProgressTime < HOUDINI_PDG_PROGRESS_INTERVAL))
+                return;
+            LastProgressTime = CurrTime;
+
+            const FString ProgressStr = FString::Printf(TEXT(" - PDG Cooking:\n%s\n%d/%d Work Items"), *Path,
+                NumCompletedWorkItems + NumErrorWorkItems, WorkItemStateMap.Num());
+            AsyncTask(ENamedThreads::GameThread, [Node, ProgressStr]
+                {
+                    if (IsValid(Node))
+                        FHoudiniEngine::Get().HoudiniAsyncTaskMessageEvent.Broadcast(FText::FromString(Node->GetActorLabel(false) + ProgressStr));
+                });
+        };
+
+    PublishProgressLambda(true);
+
+    // Work item output files are loaded by a pool of file nodes and classified here, then committed to outputs
+    // by a game thread ticker in coalesced batches, so that thousands of work items will NOT create thousands of nodes
+    TArray<TPair<FString, std::string>> PendingFiles;  // <PDGOutputIdentifier, FilePath>
+    int32 PendingFileIdx = 0;
+    const int32 FileNodePoolSize = FMath::Max(GetDefault<UHoudiniEngineSettings>()->PDGFileNodePoolSize, 1);
+    TArray<int32> FileNodeIds;  // All created file nodes, in use or free
+    const TSharedPtr<FHoudiniPDGOutputIngestor> Ingestor = MakeShared<FHoudiniPDGOutputIngestor>();
+    FTSTicker::FDelegateHandle CommitTickerHandle;
+    ON_SCOPE_EXIT
     {
-        FPlatformProcess::SleepNoStats(0.1f);
-
-        // Always query the number of graph contexts each time
-        int NumContexts = 0;
-        HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetPDGGraphContextsCount(FHoudiniEngine::Get().GetSession(), &NumContexts));
-        TArray<HAPI_StringHandle> ContextNames;
-        ContextNames.SetNumUninitialized(NumContexts);
-        TArray<int32> ContextIds;
-        ContextIds.SetNumUninitialized(NumContexts);
-        HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetPDGGraphContexts(FHoudiniEngine::Get().GetSession(),
-            ContextNames.GetData(), ContextIds.GetData(), 0, NumContexts));
+        // Stop committing first, then no result will use the file nodes, so we could delete them on every exit path
+        if (CommitTickerHandle.IsValid())
+            FTSTicker::GetCoreTicker().RemoveTicker(CommitTickerHandle);
 
+        for (const int32& FileNodeId : FileNodeIds)
+        {
+            HAPI_NodeInfo NodeInfo;
+            if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetNodeInfo(FHoudiniEngine::Get().GetSession(), FileNodeId, &NodeInfo))
+                FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), NodeInfo.parentId);
+        }
+    };
+    FHoudiniOutputClassifier OutputClassifier(FHoudiniEngine::Get().GetOutputBuilders());  // Reuse classifications among work items
+    auto HapiIngestPendingFilesLambda = [&](bool& bOutIngested) -> bool
+        {
+            bOutIngested = false;
+            while (PendingFiles.IsValidIndex(PendingFileIdx))
+            {
+                const TPair<FString, std::string>& PendingFile = PendingFiles[PendingFileIdx];
+                if (!FPaths::FileExists(PendingFile.Value.c_str()))
+                {
+                    ++PendingFileIdx;
+                    continue;
+                }
+
+                int32 FileNodeId = -1;
+                {
+                    FScopeLock ScopeLock(&Ingestor->Lock);
+                    if (!Ingestor->FreeFileNodeIds.IsEmpty())
+                        FileNodeId = Ingestor->FreeFileNodeIds.Pop();
+                }
+                if (FileNodeId < 0)
+                {
+                    if (FileNodeIds.Num() >= FileNodePoolSize)
+                        return true;  // All file nodes are in use, wait for game thread to commit
+
+                    HOUDINI_FAIL_RETURN(FHoudiniSopFile::HapiCreateNode(-1, FString(), FileNodeId));
+                    FileNodeIds.Add(FileNodeId);
+                }
+
+                const TSharedPtr<FHoudiniPDGOutputResult> Result = MakeShared<FHoudiniPDGOutputResult>();
+                Result->FileNodeId = FileNodeId;
+                if (!HapiIngestOutputFile(PendingFile.Key, PendingFile.Value, OutputClassifier, *Result))
+                {
+                    FScopeLock ScopeLock(&Ingestor->Lock);
+                    Ingestor->FreeFileNodeIds.Add(FileNodeId);  // Give it back to pool, will be deleted with the others when exit
+                    return false;
+                }
+                ++PendingFileIdx;
+                bOutIngested = true;
+
+                {
+                    FScopeLock ScopeLock(&Ingestor->Lock);
+                    Ingestor->PendingResults.Add(Result);
+                }
+
+                if (!CommitTickerHandle.IsValid())
+                {
+                    const int32 SessionIdx = FHoudiniEngine::GetCurrentSessionIndex();
+                    CommitTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+                        [this, Node, Ingestor, SessionIdx](float DeltaTime)
+                        {
+                            const FHoudiniSessionScope SessionScope(SessionIdx);
+                            if (CommitOutputs(Node, *Ingestor))
+                                return true;
+
+                            FHoudiniEngine::Get().InvalidateSessionData();
+                            return false;  // Stop ticking, so that we will NOT invalidate again and again
+                        }));
+                }
+            }
+
+            PendingFiles.Empty();
+            PendingFileIdx = 0;
+            return true;
+        };
+
+    TArray<HAPI_PDG_EventInfo> EventInfos;
+    EventInfos.SetNumUninitialized(HOUDINI_PDG_EVENT_DRAIN_SIZE);
+    float PollInterval = HOUDINI_PDG_POLL_INTERVAL_MIN;
+    bool bStopped = false;
+    for (;;)
+    {
         if (Task == EPDGTaskType::Pause)
         {
-            for (const int32& ContextId : ContextIds)
-                HAPI_SESSION_FAIL_RETURN(FHoudiniApi::PausePDGCook(FHoudiniEngine::Get().GetSession(), ContextId));
+            HAPI_SESSION_FAIL_RETURN(FHoudiniApi::PausePDGCook(FHoudiniEngine::Get().GetSession(), ContextId));
             Task = EPDGTaskType::None;
-            return true;
+            bStopped = true;
+            break;
         }
         else if (Task == EPDGTaskType::Cancel)
         {
-            for (const int32& ContextId : ContextIds)
-                HAPI_SESSION_FAIL_RETURN(FHoudiniApi::CancelPDGCook(FHoudiniEngine::Get().GetSession(), ContextId));
+            HAPI_SESSION_FAIL_RETURN(FHoudiniApi::CancelPDGCook(FHoudiniEngine::Get().GetSession(), ContextId));
             Task = EPDGTaskType::None;
-            return true;
+            bStopped = true;
+            break;
         }
 
+        // Drain all pending events, in large chunks
         bool bFinished = false;
-        for (const int32& ContextId : ContextIds)
+        int32 NumEvents = 0;
+        int leftOver = 0;
+        do
         {
-            // Check for new events
-            TArray<HAPI_PDG_EventInfo> EventInfos;
-            EventInfos.SetNumUninitialized(32);
-            int drained = 0, leftOver = 0;
+            int drained = 0;
             HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetPDGEvents(FHoudiniEngine::Get().GetSession(), ContextId,
-                EventInfos.GetData(), 32, &drained, &leftOver));
+                EventInfos.GetData(), HOUDINI_PDG_EVENT_DRAIN_SIZE, &drained, &leftOver));
+            NumEvents += drained;
+
             // Loop over the acquired events
             for (int i = 0; i < drained; i++)
             {
                 switch (EventInfos[i].eventType)
                 {
                 case HAPI_PDG_EVENT_WORKITEM_ADD:
-                case HAPI_PDG_EVENT_WORKITEM_REMOVE:
                 case HAPI_PDG_EVENT_COOK_WARNING: break;
+                case HAPI_PDG_EVENT_WORKITEM_REMOVE:
+                {
+                    HAPI_PDG_WorkItemState WorkItemState;
+                    if (WorkItemStateMap.RemoveAndCopyValue(EventInfos[i].workItemId, WorkItemState))
+                    {
+                        if (int32* Counter = GetWorkItemStateCounter(*this, WorkItemState))
+                            --(*Counter);
+                    }
+                }
+                break;
                 case HAPI_PDG_EVENT_COOK_ERROR:
                 case HAPI_PDG_EVENT_COOK_COMPLETE:
                 {
@@ -211,12 +387,13 @@ bool FHoudiniTopNode::HapiCook(AHoudiniNode* Node)
                     {
                     case HAPI_PDG_WORKITEM_COOKED_SUCCESS:
                     case HAPI_PDG_WORKITEM_COOKED_CACHE:
-                    if (bIsOutput)
                     {
-                        HAPI_PDG_WorkItemState& WorkItemState = WorkItemStateMap.FindOrAdd(WorkItemId);
-                        if (WorkItemState == HAPI_PDG_WORKITEM_COOKED_SUCCESS)
+                        const HAPI_PDG_WorkItemState* WorkItemStatePtr = WorkItemStateMap.Find(WorkItemId);
+                        if (WorkItemStatePtr && (*WorkItemStatePtr == HAPI_PDG_WORKITEM_COOKED_SUCCESS))
+                            break;
+                        SetWorkItemStateLambda(WorkItemId, HAPI_PDG_WORKITEM_COOKED_SUCCESS);
+                        if (!bIsOutput)
                             break;
-                        WorkItemState = HAPI_PDG_WORKITEM_COOKED_SUCCESS;
 
                         HAPI_PDG_WorkItemInfo WorkItemInfo;
                         HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetWorkItemInfo(FHoudiniEngine::Get().GetSession(),
@@ -234,27 +411,16 @@ bool FHoudiniTopNode::HapiCook(AHoudiniNode* Node)
 
                             TArray<std::string> FilePaths;
                             HOUDINI_FAIL_RETURN(FHoudiniEngineUtils::HapiConvertStringHandles(FilePathSHs, FilePaths));
-                            AsyncTask(ENamedThreads::GameThread, [this, Node, FilePaths, WorkItemOutputIdx]
-                                {
-                                    int32 FileInputNodeId = -1;
-                                    for (int32 FileIdx = 0; FileIdx < FilePaths.Num(); ++FileIdx)
-                                        HOUDINI_FAIL_INVALIDATE_RETURN(this->HapiUpdateOutputs(Node,
-                                            FString::Printf(TEXT("%d_%d"), WorkItemOutputIdx, FileIdx), FilePaths[FileIdx], FileInputNodeId));
-
-                                    HAPI_NodeInfo NodeInfo;
-                                    FHoudiniApi::GetNodeInfo(FHoudiniEngine::Get().GetSession(), FileInputNodeId, &NodeInfo);
-                                    FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), NodeInfo.parentId);
-                                });
+                            for (int32 FileIdx = 0; FileIdx < FilePaths.Num(); ++FileIdx)
+                                PendingFiles.Add(TPair<FString, std::string>(FString::Printf(TEXT("%d_%d"), WorkItemOutputIdx, FileIdx), FilePaths[FileIdx]));
 
                             ++WorkItemOutputIdx;
                         }
                     }
-                    else
-                        WorkItemStateMap.FindOrAdd(WorkItemId) = HAPI_PDG_WORKITEM_COOKED_SUCCESS;
                     break;
-                    case HAPI_PDG_WORKITEM_COOKED_FAIL: WorkItemStateMap.FindOrAdd(WorkItemId) = HAPI_PDG_WORKITEM_COOKED_FAIL; break;
-                    case HAPI_PDG_WORKITEM_COOKING: WorkItemStateMap.FindOrAdd(WorkItemId) = HAPI_PDG_WORKITEM_COOKING; break;
-                    case HAPI_PDG_WORKITEM_WAITING: WorkItemStateMap.FindOrAdd(WorkItemId) = HAPI_PDG_WORKITEM_WAITING; break;
+                    case HAPI_PDG_WORKITEM_COOKED_FAIL: SetWorkItemStateLambda(WorkItemId, HAPI_PDG_WORKITEM_COOKED_FAIL); break;
+                    case HAPI_PDG_WORKITEM_COOKING: SetWorkItemStateLambda(WorkItemId, HAPI_PDG_WORKITEM_COOKING); break;
+                    case HAPI_PDG_WORKITEM_WAITING: SetWorkItemStateLambda(WorkItemId, HAPI_PDG_WORKITEM_WAITING); break;
                     }
                 }
                 break;
@@ -262,23 +428,43 @@ bool FHoudiniTopNode::HapiCook(AHoudiniNode* Node)
                     break;
                 }
             }
-        }
+        } while (leftOver > 0);
+
+        bool bIngested = false;
+        HOUDINI_FAIL_RETURN(HapiIngestPendingFilesLambda(bIngested));
 
-        ResetStates();
-        for (const auto& WorkItemState : WorkItemStateMap)
+        if (bFinished)
+            break;
+
+        if ((NumEvents > 0) || bIngested)
         {
-            switch (WorkItemState.Value)
-            {
-            case HAPI_PDG_WORKITEM_COOKED_FAIL:  ++NumErrorWorkItems; break;
-            case HAPI_PDG_WORKITEM_COOKED_SUCCESS:  ++NumCompletedWorkItems; break;
-            case HAPI_PDG_WORKITEM_COOKING:  ++NumRunningWorkItems; break;
-            case HAPI_PDG_WORKITEM_WAITING:  ++NumWaitingWorkItems; break;
-            }
+            PublishProgressLambda(false);
+            PollInterval = HOUDINI_PDG_POLL_INTERVAL_MIN;
         }
+        else
+            PollInterval = FMath::Min(PollInterval * 2.0f, HOUDINI_PDG_POLL_INTERVAL_MAX);
 
-        if (bFinished)
+        FPlatformProcess::SleepNoStats(PollInterval);
+    }
+
+    PublishProgressLambda(true);
+
+    // Ingest the rest files, and wait for all results committed, then we could safely delete the file nodes
+    for (;;)
+    {
+        if (Ingestor->HasCommitFailed())
+            return false;  // Session has been invalidated by committer
+
+        bool bIngested = false;
+        HOUDINI_FAIL_RETURN(HapiIngestPendingFilesLambda(bIngested));
+        if (PendingFiles.IsEmpty() && (Ingestor->NumUncommitted() <= 0))
             break;
-    } 
+
+        FPlatformProcess::SleepNoStats(HOUDINI_PDG_POLL_INTERVAL_MIN);
+    }
+
+    if (bStopped)
+        return true;
 
     // Clean up outputs that OutputName is empty (means is stale and pending destroy)
     AsyncTask(ENamedThreads::GameThread, [this]
@@ -297,91 +483,114 @@ bool FHoudiniTopNode::HapiCook(AHoudiniNode* Node)
 	return true;
 }
 
-bool FHoudiniTopNode::HapiUpdateOutputs(AHoudiniNode* Node, const FString& PDGOutputIdentifier, const std::string& FilePath, int32& InOutFileInputNodeId)
+bool FHoudiniTopNode::HapiIngestOutputFile(const FString& PDGOutputIdentifier, const std::string& FilePath,
+    FHoudiniOutputClassifier& OutputClassifier, FHoudiniPDGOutputResult& OutResult) const
 {
-    if (!FPaths::FileExists(FilePath.c_str()))
-        return true;
-
-    if (InOutFileInputNodeId < 0)
-        HOUDINI_FAIL_RETURN(FHoudiniSopFile::HapiCreateNode(-1, FString(), InOutFileInputNodeId));
+    const int32& FileNodeId = OutResult.FileNodeId;
+    HOUDINI_FAIL_RETURN(FHoudiniSopFile::HapiLoadFile(FileNodeId, FilePath.c_str()));
+    HAPI_SESSION_FAIL_RETURN(FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), FileNodeId, nullptr));
 
-    HOUDINI_FAIL_RETURN(FHoudiniSopFile::HapiLoadFile(InOutFileInputNodeId, FilePath.c_str()));
-    HAPI_SESSION_FAIL_RETURN(FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), InOutFileInputNodeId, nullptr));
+    HAPI_GeoInfo& GeoInfo = OutResult.GeoInfo;
+    HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetGeoInfo(FHoudiniEngine::Get().GetSession(), FileNodeId, &GeoInfo));
 
-    HAPI_GeoInfo GeoInfo;
-    HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetGeoInfo(FHoudiniEngine::Get().GetSession(), InOutFileInputNodeId, &GeoInfo));
-    
-    const TArray<TSharedPtr<IHoudiniOutputBuilder>>& OutputBuilders = FHoudiniEngine::Get().GetOutputBuilders();
+    OutResult.OutputName = FHoudiniEngineUtils::GetValidatedString(Path) + PDGOutputIdentifier;
 
-    struct FHoudiniOutputDesc
+    for (int32 PartIdx = 0; PartIdx < GeoInfo.partCount; ++PartIdx)
     {
-        FHoudiniOutputDesc(UHoudiniOutput* InOutput, const HAPI_PartInfo& PartInfo) : Output(InOutput)
+        HAPI_PartInfo PartInfo;
+        HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetPartInfo(FHoudiniEngine::Get().GetSession(), GeoInfo.nodeId, PartIdx, &PartInfo));
+        TSharedPtr<IHoudiniOutputBuilder> OutputBuilder;
+        bool bShouldHoldByOutput = false;
+        HOUDINI_FAIL_RETURN(OutputClassifier.HapiClassify(GeoInfo.nodeId, PartInfo, OutputBuilder, bShouldHoldByOutput));
+        if (!OutputBuilder)
+            continue;
+
+        if (bShouldHoldByOutput)
         {
-            PartInfos.Add(PartInfo);
+            const TSubclassOf<UHoudiniOutput> OutputClass = OutputBuilder->GetClass();
+            if (TPair<TSubclassOf<UHoudiniOutput>, TArray<HAPI_PartInfo>>* FoundHeldPartInfosPtr = OutResult.HeldPartInfos.FindByPredicate(
+                [OutputClass](const TPair<TSubclassOf<UHoudiniOutput>, TArray<HAPI_PartInfo>>& HeldPartInfos) { return HeldPartInfos.Key == OutputClass; }))
+                FoundHeldPartInfosPtr->Value.Add(PartInfo);
+            else
+                OutResult.HeldPartInfos.Add(TPair<TSubclassOf<UHoudiniOutput>, TArray<HAPI_PartInfo>>(OutputClass, { PartInfo }));
         }
+        else
+            OutResult.ConvertedPartInfos.FindOrAdd(OutputBuilder).Add(PartInfo);
+    }
 
-        UHoudiniOutput* Output;  // Should never be nullptr
-        TArray<HAPI_PartInfo> PartInfos;
-    };
+    return true;
+}
 
-    const FString OutputName = FHoudiniEngineUtils::GetValidatedString(Path) + PDGOutputIdentifier;
+bool FHoudiniTopNode::HapiCommitOutputs(AHoudiniNode* Node, const FHoudiniPDGOutputResult& Result)
+{
+    // Builders and outputs fetch part data and create/update UObjects in the same pass (also shared by the node cook),
+    // so attribute fetches still run here on game thread, CommitOutputs bounds them by PDGOutputCommitBudget per frame
+    for (const auto& OutputConverter : Result.ConvertedPartInfos)
+        HOUDINI_FAIL_RETURN(OutputConverter.Key->HapiRetrieve(Node, Result.OutputName, Result.GeoInfo, OutputConverter.Value));
 
-    TArray<FHoudiniOutputDesc> OutputDescs;
-    TMap<TSharedPtr<IHoudiniOutputBuilder>, TArray<HAPI_PartInfo>> OutputConverters;
-    for (int32 PartIdx = 0; PartIdx < GeoInfo.partCount; ++PartIdx)
+    for (const TPair<TSubclassOf<UHoudiniOutput>, TArray<HAPI_PartInfo>>& HeldPartInfos : Result.HeldPartInfos)
     {
-        HAPI_PartInfo PartInfo;
-        HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetPartInfo(FHoudiniEngine::Get().GetSession(), GeoInfo.nodeId, PartIdx, &PartInfo));
-        for (int32 BuilderIdx = OutputBuilders.Num() - 1; BuilderIdx >= 0; --BuilderIdx)
+        const TSubclassOf<UHoudiniOutput>& OutputClass = HeldPartInfos.Key;
+        UHoudiniOutput* FoundOutput = nullptr;
+        for (UHoudiniOutput* Output : Outputs)
         {
-            const TSharedPtr<IHoudiniOutputBuilder>& OutputBuilder = OutputBuilders[BuilderIdx];
-            bool bIsValid = false;
-            bool bShouldHoldByOutput = false;
-            HOUDINI_FAIL_RETURN(OutputBuilder->HapiIsPartValid(GeoInfo.nodeId, PartInfo, bIsValid, bShouldHoldByOutput));
-            if (bIsValid)
+            if (Output->GetOutputName().IsEmpty() && Output->GetClass() == OutputClass)
             {
-                if (bShouldHoldByOutput)
-                {
-                    const TSubclassOf<UHoudiniOutput> OutputClass = OutputBuilder->GetClass();
-                    if (FHoudiniOutputDesc* FoundOutputDescPtr = OutputDescs.FindByPredicate(
-                        [OutputClass](const FHoudiniOutputDesc& OutputDesc) { return OutputDesc.Output->GetClass() == OutputClass; }))
-                        FoundOutputDescPtr->PartInfos.Add(PartInfo);
-                    else
-                    {
-                        UHoudiniOutput* FoundOutput = nullptr;
-                        for (UHoudiniOutput* Output : Outputs)
-                        {
-                            if (Output->GetOutputName().IsEmpty() && Output->GetClass() == OutputClass)
-                            {
-                                ((FHoudiniOutputNameAccessor*)Output)->Set(OutputName);  // Set name to prevent from destroy
-                                FoundOutput = Output;
-                                break;
-                            }
-                        }
+                FoundOutput = Output;
+                break;
+            }
+        }
 
-                        if (!FoundOutput)
-                        {
-                            FoundOutput = NewObject<UHoudiniOutput>(Node, OutputClass, MakeUniqueObjectName(Node, OutputClass, "HoudiniPDGOutput"), RF_Public | RF_Transactional);
-                            Outputs.Add(FoundOutput);
-                            ((FHoudiniOutputNameAccessor*)FoundOutput)->Set(OutputName);  // Set name to prevent from destroy
-                        }
+        if (!FoundOutput)
+        {
+            FoundOutput = NewObject<UHoudiniOutput>(Node, OutputClass, MakeUniqueObjectName(Node, OutputClass, "HoudiniPDGOutput"), RF_Public | RF_Transactional);
+            Outputs.Add(FoundOutput);
+        }
+        ((FHoudiniOutputNameAccessor*)FoundOutput)->Set(Result.OutputName);  // Set name to prevent from destroy
 
-                        OutputDescs.Add(FHoudiniOutputDesc(FoundOutput, PartInfo));
-                    }
-                }
-                else
-                    OutputConverters.FindOrAdd(OutputBuilder).Add(PartInfo);
+        HOUDINI_FAIL_RETURN(FoundOutput->HapiUpdate(Result.GeoInfo, HeldPartInfos.Value));
+    }
 
+    return true;
+}
+
+bool FHoudiniTopNode::CommitOutputs(AHoudiniNode* Node, FHoudiniPDGOutputIngestor& Ingestor)
+{
+    // Commit as many results as possible within the time budget, the rest will be committed in next frames
+    const double CommitBudget = double(GetDefault<UHoudiniEngineSettings>()->PDGOutputCommitBudget) * 0.001;
+    const double StartTime = FPlatformTime::Seconds();
+    for (;;)
+    {
+        TSharedPtr<FHoudiniPDGOutputResult> Result;
+        {
+            FScopeLock ScopeLock(&Ingestor.Lock);
+            if (!Ingestor.PendingResults.IsValidIndex(Ingestor.CommitIdx))
                 break;
-            }
+            Result = Ingestor.PendingResults[Ingestor.CommitIdx];
         }
-    }
 
-    for (const auto& OutputConverter : OutputConverters)
-        HOUDINI_FAIL_RETURN(OutputConverter.Key->HapiRetrieve(Node, OutputName, GeoInfo, OutputConverter.Value));
+        if (IsValid(Node) && !HapiCommitOutputs(Node, *Result))
+        {
+            FScopeLock ScopeLock(&Ingestor.Lock);
+            Ingestor.bCommitFailed = true;
+            return false;
+        }
 
-    for (const FHoudiniOutputDesc& OutputDesc : OutputDescs)
-        HOUDINI_FAIL_RETURN(OutputDesc.Output->HapiUpdate(GeoInfo, OutputDesc.PartInfos));
+        {
+            FScopeLock ScopeLock(&Ingestor.Lock);
+            Ingestor.PendingResults[Ingestor.CommitIdx].Reset();
+            ++Ingestor.CommitIdx;
+            if (Ingestor.CommitIdx >= Ingestor.PendingResults.Num())
+            {
+                Ingestor.PendingResults.Reset();
+                Ingestor.CommitIdx = 0;
+            }
+            Ingestor.FreeFileNodeIds.Add(Result->FileNodeId);  // Now the file node could be reused
+        }
+
+        if (FPlatformTime::Seconds() - StartTime >= CommitBudget)
+            break;
+    }
 
     return true;
 }
@@ -2,6 +2,8 @@
 
 #include "HoudiniParameters.h"
 
+#include "Algo/Compare.h"
+
 #include "HoudiniApi.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
@@ -45,6 +47,25 @@ uint32 GetTypeHash(const FHoudiniParameterNameHolder& NameHolder)
 	return FCrc::StrCrc32(*(*(NameHolder.StrPtr)));
 }
 
+static uint32 GetParameterTemplateHash(const HAPI_NodeInfo& NodeInfo, const TArray<HAPI_ParmInfo>& ParmInfos)
+{
+	uint32 Hash = HashCombine(GetTypeHash(NodeInfo.type), GetTypeHash((NodeInfo.inputCount << 16) | NodeInfo.outputCount));
+	Hash = HashCombine(Hash, GetTypeHash(NodeInfo.parmCount));
+	Hash = HashCombine(Hash, GetTypeHash(NodeInfo.parmIntValueCount));
+	Hash = HashCombine(Hash, GetTypeHash(NodeInfo.parmFloatValueCount));
+	Hash = HashCombine(Hash, GetTypeHash(NodeInfo.parmStringValueCount));
+	Hash = HashCombine(Hash, GetTypeHash(NodeInfo.parmChoiceCount));
+	for (HAPI_ParmInfo ParmInfo : ParmInfos)
+	{
+		// String handles may differ between calls, so mask them, names, labels and helps will refresh when anything else changed
+		ParmInfo.typeInfoSH = ParmInfo.nameSH = ParmInfo.labelSH = ParmInfo.templateNameSH = ParmInfo.helpSH = 0;
+		ParmInfo.visibilityConditionSH = ParmInfo.disabledConditionSH = 0;
+		Hash = HashCombine(Hash, FCrc::MemCrc32(&ParmInfo, sizeof(HAPI_ParmInfo)));
+	}
+
+	return (Hash == 0) ? 1 : Hash;  // 0 is reserved for "NOT synced"
+}
+
 bool AHoudiniNode::HapiUpdateParameters(const bool& bBeforeCook)
 {
 	const double StartTime = FPlatformTime::Seconds();
@@ -110,6 +131,18 @@ bool AHoudiniNode::HapiUpdateParameters(const bool& bBeforeCook)
 	HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetNodeInfo(FHoudiniEngine::Get().GetSession(), NodeId, &NodeInfo));
 	GeoNodeId = (NodeInfo.type == HAPI_NODETYPE_OBJ) ? -1 : NodeInfo.parentId;
 
+	TArray<HAPI_ParmInfo> ParmInfos;
+	if (NodeInfo.parmCount >= 1)
+	{
+		ParmInfos.SetNumZeroed(NodeInfo.parmCount);  // Zeroed, as paddings will also be hashed
+		HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetParameters(FHoudiniEngine::Get().GetSession(), NodeId,
+			ParmInfos.GetData(), 0, NodeInfo.parmCount));
+	}
+
+	// If parm templates NOT changed after cook, then we could only refresh parm values
+	const uint32 NewParmTemplateHash = GetParameterTemplateHash(NodeInfo, ParmInfos);
+	const bool bParmTemplateChanged = bBeforeCook || Preset.IsValid() || (NewParmTemplateHash != ParmTemplateHash);
+
 	// Get all int values
 	TArray<int32> IntValues;
 	if (NodeInfo.parmIntValueCount >= 1)
@@ -128,34 +161,23 @@ bool AHoudiniNode::HapiUpdateParameters(const bool& bBeforeCook)
 			FloatValues.GetData(), 0, NodeInfo.parmFloatValueCount));
 	}
 
-	TArray<HAPI_ParmInfo> ParmInfos;
 	TArray<FString> AllStrings;
 	TConstArrayView<FString> StringValues;
 	TConstArrayView<FString> ParmNames, ParmLabels, ParmHelps;
 	TConstArrayView<FString> ChoiceValues, ChoiceLabels;
+	const int32 NumValueStrings = NodeInfo.parmStringValueCount + NodeInfo.parmChoiceCount * 2;
+	const int32 NumTemplateStrings = bParmTemplateChanged ? NodeInfo.parmCount * 3 : 0;  // Need NOT convert names, labels and helps for value refresh
 	if (NodeInfo.parmCount >= 1)
 	{
 		// Get all string values and infos
 		TArray<HAPI_StringHandle> AllSHs;
-		// { StringValues, (ParmNames, ParmLabels, ParmHelps), (ChoiceValues, ChoiceLabels) }
-		AllSHs.SetNumUninitialized(NodeInfo.parmStringValueCount + NodeInfo.parmCount * 3 + NodeInfo.parmChoiceCount * 2);
+		// { StringValues, (ChoiceValues, ChoiceLabels), (ParmNames, ParmLabels, ParmHelps) }
+		AllSHs.SetNumUninitialized(NumValueStrings + NumTemplateStrings);
 		if (NodeInfo.parmStringValueCount >= 1)
 			HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetParmStringValues(FHoudiniEngine::Get().GetSession(), NodeId, false,
 				AllSHs.GetData(), 0, NodeInfo.parmStringValueCount));
 
-		ParmInfos.SetNumUninitialized(NodeInfo.parmCount);
-		HAPI_SESSION_FAIL_RETURN(FHoudiniApi::GetParameters(FHoudiniEngine::Get().GetSession(), NodeId,
-			ParmInfos.GetData(), 0, NodeInfo.parmCount));
-
-		for (int32 ParmIndex = 0; ParmIndex < NodeInfo.parmCount; ++ParmIndex)
-		{
-			const HAPI_ParmInfo& ParmInfo = ParmInfos[ParmIndex];
-			AllSHs[NodeInfo.parmStringValueCount + ParmIndex] = ParmInfo.nameSH;
-			AllSHs[NodeInfo.parmStringValueCount + NodeInfo.parmCount + ParmIndex] = ParmInfo.labelSH;
-			AllSHs[NodeInfo.parmStringValueCount + NodeInfo.parmCount * 2 + ParmIndex] = ParmInfo.helpSH;
-		}
-
-		TArray<HAPI_ParmChoiceInfo> ChoiceInfos;
+		TArray<HAPI_ParmChoiceInfo> ChoiceInfos;  // Choices may generated by menu scripts, so we should always retrieve them
 		if (NodeInfo.parmChoiceCount >= 1)
 		{
 			ChoiceInfos.SetNumUninitialized(NodeInfo.parmChoiceCount);
@@ -165,19 +187,70 @@ bool AHoudiniNode::HapiUpdateParameters(const bool& bBeforeCook)
 			for (int32 ChoiceIndex = 0; ChoiceIndex < NodeInfo.parmChoiceCount; ++ChoiceIndex)
 			{
 				const HAPI_ParmChoiceInfo& ChoiceInfo = ChoiceInfos[ChoiceIndex];
-				AllSHs[NodeInfo.parmStringValueCount + NodeInfo.parmCount * 3 + ChoiceIndex] = ChoiceInfo.valueSH;
-				AllSHs[NodeInfo.parmStringValueCount + NodeInfo.parmCount * 3 + NodeInfo.parmChoiceCount + ChoiceIndex] = ChoiceInfo.labelSH;
+				AllSHs[NodeInfo.parmStringValueCount + ChoiceIndex] = ChoiceInfo.valueSH;
+				AllSHs[NodeInfo.parmStringValueCount + NodeInfo.parmChoiceCount + ChoiceIndex] = ChoiceInfo.labelSH;
 			}
 		}
 
+		for (int32 ParmIndex = 0; ParmIndex < NumTemplateStrings / 3; ++ParmIndex)
+		{
+			const HAPI_ParmInfo& ParmInfo = ParmInfos[ParmIndex];
+			AllSHs[NumValueStrings + ParmIndex] = ParmInfo.nameSH;
+			AllSHs[NumValueStrings + NodeInfo.parmCount + ParmIndex] = ParmInfo.labelSH;
+			AllSHs[NumValueStrings + NodeInfo.parmCount * 2 + ParmIndex] = ParmInfo.helpSH;
+		}
+
 		HOUDINI_FAIL_RETURN(FHoudiniEngineUtils::HapiConvertStringHandles(AllSHs, AllStrings));
-		FString* AllStringsPtr = AllStrings.GetData();
+
+		const FString* AllStringsPtr = AllStrings.GetData();
 		StringValues = TConstArrayView<FString>(AllStringsPtr, NodeInfo.parmStringValueCount);
-		ParmNames = TConstArrayView<FString>(AllStringsPtr + NodeInfo.parmStringValueCount, NodeInfo.parmCount);
-		ParmLabels = TConstArrayView<FString>(AllStringsPtr + NodeInfo.parmStringValueCount + NodeInfo.parmCount, NodeInfo.parmCount);
-		ParmHelps = TConstArrayView<FString>(AllStringsPtr + NodeInfo.parmStringValueCount + NodeInfo.parmCount * 2, NodeInfo.parmCount);
-		ChoiceValues = TConstArrayView<FString>(AllStringsPtr + NodeInfo.parmStringValueCount + NodeInfo.parmCount * 3, NodeInfo.parmChoiceCount);
-		ChoiceLabels = TConstArrayView<FString>(AllStringsPtr + NodeInfo.parmStringValueCount + NodeInfo.parmCount * 3 + NodeInfo.parmChoiceCount, NodeInfo.parmChoiceCount);
+		ChoiceValues = TConstArrayView<FString>(AllStringsPtr + NodeInfo.parmStringValueCount, NodeInfo.parmChoiceCount);
+		ChoiceLabels = TConstArrayView<FString>(AllStringsPtr + NodeInfo.parmStringValueCount + NodeInfo.parmChoiceCount, NodeInfo.parmChoiceCount);
+		if (NumTemplateStrings >= 1)
+		{
+			ParmNames = TConstArrayView<FString>(AllStringsPtr + NumValueStrings, NodeInfo.parmCount);
+			ParmLabels = TConstArrayView<FString>(AllStringsPtr + NumValueStrings + NodeInfo.parmCount, NodeInfo.parmCount);
+			ParmHelps = TConstArrayView<FString>(AllStringsPtr + NumValueStrings + NodeInfo.parmCount * 2, NodeInfo.parmCount);
+		}
+	}
+
+	const TConstArrayView<FString> ValueStrings(AllStrings.GetData(), FMath::Min(NumValueStrings, AllStrings.Num()));
+	if (!bParmTemplateChanged)
+	{
+		if (!bParmsUploadedSinceSync && (IntValues == SyncedIntValues) && (FloatValues == SyncedFloatValues) &&
+			Algo::Compare(ValueStrings, SyncedValueStrings, [](const FString& Str, const FString& SyncedStr) { return Str.Equals(SyncedStr, ESearchCase::CaseSensitive); }))
+		{
+			const double TimeCost = FPlatformTime::Seconds() - StartTime;
+			if (TimeCost > 0.005)
+				UE_LOG(LogHoudiniEngine, Log, TEXT("%s: Update Parameters %.3f (s), values NOT changed"), *GetActorLabel(false), TimeCost);
+
+			return true;  // Parms are identical to houdini, nothing need to update
+		}
+
+		// Parm ids and value indices are NOT changed, so we could just refresh values of the existing parms in place
+		TMap<int32, int32> ParmIdIdxMap;
+		for (int32 ParmIdx = 0; ParmIdx < NodeInfo.parmCount; ++ParmIdx)
+			ParmIdIdxMap.Add(ParmInfos[ParmIdx].id, ParmIdx);
+
+		for (UHoudiniParameter* Parm : Parms)  // AttribParms do NOT update values from houdini
+		{
+			if (const int32* FoundParmIdxPtr = ParmIdIdxMap.Find(Parm->GetId()))
+			{
+				Parm->UpdateValuesAndChoices(ParmInfos[*FoundParmIdxPtr], IntValues, FloatValues, StringValues, ChoiceValues, ChoiceLabels, true, false);
+				Parm->UpdateBackupValueString();
+			}
+		}
+
+		SyncedIntValues = MoveTemp(IntValues);
+		SyncedFloatValues = MoveTemp(FloatValues);
+		SyncedValueStrings = TArray<FString>(ValueStrings);
+		bParmsUploadedSinceSync = false;
+
+		const double TimeCost = FPlatformTime::Seconds() - StartTime;
+		if (TimeCost > 0.005)
+			UE_LOG(LogHoudiniEngine, Log, TEXT("%s: Update Parameters %.3f (s), only values refreshed"), *GetActorLabel(false), TimeCost);
+
+		return true;
 	}
 
 
@@ -412,6 +485,16 @@ bool AHoudiniNode::HapiUpdateParameters(const bool& bBeforeCook)
 	Parms = NewParms;
 	GroupParmSetMap = NewAttribParmSetMap;
 
+	// Record the synced state, parm values will NOT update when before cook, so we should NOT treat them as synced
+	ParmTemplateHash = bBeforeCook ? 0 : NewParmTemplateHash;
+	if (!bBeforeCook)
+	{
+		SyncedIntValues = MoveTemp(IntValues);
+		SyncedFloatValues = MoveTemp(FloatValues);
+		SyncedValueStrings = TArray<FString>(ValueStrings);
+		bParmsUploadedSinceSync = false;
+	}
+
 	if (!GroupParmSetMap.IsEmpty() && (NodeInfo.inputCount == 1) && (NodeInfo.outputCount == 1) && (NodeInfo.type == HAPI_NODETYPE_SOP))
 	{
 		InputCount = 0;
@@ -475,6 +558,7 @@ void AHoudiniNode::SetParameterValues(const TMap<FName, FHoudiniGenericParameter
 			MutablePreset->FindOrAdd(Parm.Key) = Parm.Value;
 	}
 
+	LastCookKey = 0;
 	RequestCook();
 }
 
@@ -585,8 +669,26 @@ bool UHoudiniParameter::HapiCreateOrUpdate(AHoudiniNode* Node,
 	InOutParm->Help = ParmHelp;
 	InOutParm->HapiUpdateFromInfo(InParmInfo, bUpdateTags);
 
-	// Update values and default values
-	switch (InOutParm->GetType())
+	if (bUpdateTags && (InOutParm->GetType() == EHoudiniParameterType::Asset))
+		((UHoudiniParameterAsset*)InOutParm)->SetShouldImportInfo(bImportInfo);
+
+	// Update values and default values, default count of reused MultiParms has been update via UHoudiniMultiParameter::HapiSync
+	InOutParm->UpdateValuesAndChoices(InParmInfo, IntValues, FloatValues, StringValues, ChoiceValues, ChoiceLabels,
+		bUpdateValues, bUpdateDefaultValues && ((InOutParm->GetType() != EHoudiniParameterType::MultiParm) || (PrevParm != InOutParm)));
+
+	// Try reuse the previous values of legacy parm if possible
+	if (!bIsAttribute && bBeforeCook && PrevParm && (PrevParm != InOutParm))
+		InOutParm->ReuseValuesFromLegacyParameter(PrevParm);
+
+	return true;
+}
+
+void UHoudiniParameter::UpdateValuesAndChoices(const HAPI_ParmInfo& InParmInfo,
+	const TArray<int32>& IntValues, const TArray<float>& FloatValues, TConstArrayView<FString> StringValues,
+	TConstArrayView<FString> ChoiceValues, TConstArrayView<FString> ChoiceLabels,
+	const bool& bUpdateValues, const bool& bUpdateDefaultValues)
+{
+	switch (Type)
 	{
 	case EHoudiniParameterType::Separator: break;
 	case EHoudiniParameterType::Folder: break;
@@ -595,111 +697,104 @@ bool UHoudiniParameter::HapiCreateOrUpdate(AHoudiniNode* Node,
 	// Int types
 	case EHoudiniParameterType::Int:
 	{
-		if (bUpdateValues) ((UHoudiniParameterInt*)InOutParm)->UpdateValues(IntValues);
-		if (bUpdateDefaultValues) ((UHoudiniParameterInt*)InOutParm)->UpdateDefaultValues(IntValues);
+		if (bUpdateValues) ((UHoudiniParameterInt*)this)->UpdateValues(IntValues);
+		if (bUpdateDefaultValues) ((UHoudiniParameterInt*)this)->UpdateDefaultValues(IntValues);
 	}
 	break;
 	case EHoudiniParameterType::IntChoice:
 	{
-		if (bUpdateValues) ((UHoudiniParameterIntChoice*)InOutParm)->UpdateValue(IntValues);
-		if (bUpdateDefaultValues) ((UHoudiniParameterIntChoice*)InOutParm)->UpdateDefaultValue(IntValues);
+		if (bUpdateValues) ((UHoudiniParameterIntChoice*)this)->UpdateValue(IntValues);
+		if (bUpdateDefaultValues) ((UHoudiniParameterIntChoice*)this)->UpdateDefaultValue(IntValues);
 		if (InParmInfo.useMenuItemTokenAsValue)
-			((UHoudiniParameterIntChoice*)InOutParm)->UpdateChoices(InParmInfo.choiceIndex, InParmInfo.choiceCount, ChoiceValues, ChoiceLabels);
+			((UHoudiniParameterIntChoice*)this)->UpdateChoices(InParmInfo.choiceIndex, InParmInfo.choiceCount, ChoiceValues, ChoiceLabels);
 		else
-			((UHoudiniParameterIntChoice*)InOutParm)->UpdateChoices(InParmInfo.choiceIndex, InParmInfo.choiceCount, ChoiceLabels);
+			((UHoudiniParameterIntChoice*)this)->UpdateChoices(InParmInfo.choiceIndex, InParmInfo.choiceCount, ChoiceLabels);
 	}
 	break;
 	case EHoudiniParameterType::ButtonStrip:
 	{
-		if (bUpdateValues) ((UHoudiniParameterButtonStrip*)InOutParm)->UpdateValue(IntValues);
-		if (bUpdateDefaultValues) ((UHoudiniParameterButtonStrip*)InOutParm)->UpdateDefaultValue(IntValues);
-		((UHoudiniParameterButtonStrip*)InOutParm)->UpdateChoices(InParmInfo.choiceIndex, InParmInfo.choiceCount, ChoiceLabels);
+		if (bUpdateValues) ((UHoudiniParameterButtonStrip*)this)->UpdateValue(IntValues);
+		if (bUpdateDefaultValues) ((UHoudiniParameterButtonStrip*)this)->UpdateDefaultValue(IntValues);
+		((UHoudiniParameterButtonStrip*)this)->UpdateChoices(InParmInfo.choiceIndex, InParmInfo.choiceCount, ChoiceLabels);
 	}
 	break;
 	case EHoudiniParameterType::Toggle:
 	{
-		if (bUpdateValues) ((UHoudiniParameterToggle*)InOutParm)->UpdateValue(IntValues);
-		if (bUpdateDefaultValues) ((UHoudiniParameterToggle*)InOutParm)->UpdateDefaultValue(IntValues);
+		if (bUpdateValues) ((UHoudiniParameterToggle*)this)->UpdateValue(IntValues);
+		if (bUpdateDefaultValues) ((UHoudiniParameterToggle*)this)->UpdateDefaultValue(IntValues);
 	}
 	break;
 	case EHoudiniParameterType::FolderList:
 	{
 		if (bUpdateValues && InParmInfo.type == HAPI_PARMTYPE_FOLDERLIST_RADIO)
-			((UHoudiniParameterFolderList*)InOutParm)->UpdateValue(IntValues);
+			((UHoudiniParameterFolderList*)this)->UpdateValue(IntValues);
 	}
 	break;
 	
 	// Float types
 	case EHoudiniParameterType::Float:
 	{
-		if (bUpdateValues) ((UHoudiniParameterFloat*)InOutParm)->UpdateValues(FloatValues);
-		if (bUpdateDefaultValues) ((UHoudiniParameterFloat*)InOutParm)->UpdateDefaultValues(FloatValues);
+		if (bUpdateValues) ((UHoudiniParameterFloat*)this)->UpdateValues(FloatValues);
+		if (bUpdateDefaultValues) ((UHoudiniParameterFloat*)this)->UpdateDefaultValues(FloatValues);
 	}
 	break;
 	case EHoudiniParameterType::Color:
 	{
-		if (bUpdateValues) ((UHoudiniParameterColor*)InOutParm)->UpdateValues(FloatValues);
-		if (bUpdateDefaultValues) ((UHoudiniParameterColor*)InOutParm)->UpdateDefaultValues(FloatValues);
+		if (bUpdateValues) ((UHoudiniParameterColor*)this)->UpdateValues(FloatValues);
+		if (bUpdateDefaultValues) ((UHoudiniParameterColor*)this)->UpdateDefaultValues(FloatValues);
 	}
 	break;
 
 	// String types
 	case EHoudiniParameterType::String:
 	{
-		if (bUpdateValues) ((UHoudiniParameterString*)InOutParm)->UpdateValue(StringValues);
-		if (bUpdateDefaultValues) ((UHoudiniParameterString*)InOutParm)->UpdateDefaultValue(StringValues);
+		if (bUpdateValues) ((UHoudiniParameterString*)this)->UpdateValue(StringValues);
+		if (bUpdateDefaultValues) ((UHoudiniParameterString*)this)->UpdateDefaultValue(StringValues);
 	}
 	break;
 	case EHoudiniParameterType::StringChoice:
 	{
-		if (bUpdateValues) ((UHoudiniParameterStringChoice*)InOutParm)->UpdateValue(StringValues);
-		if (bUpdateDefaultValues) ((UHoudiniParameterStringChoice*)InOutParm)->UpdateDefaultValue(StringValues);
-		((UHoudiniParameterStringChoice*)InOutParm)->UpdateChoices(InParmInfo.choiceIndex, InParmInfo.choiceCount, ChoiceValues, ChoiceLabels);
+		if (bUpdateValues) ((UHoudiniParameterStringChoice*)this)->UpdateValue(StringValues);
+		if (bUpdateDefaultValues) ((UHoudiniParameterStringChoice*)this)->UpdateDefaultValue(StringValues);
+		((UHoudiniParameterStringChoice*)this)->UpdateChoices(InParmInfo.choiceIndex, InParmInfo.choiceCount, ChoiceValues, ChoiceLabels);
 	}
 	break;
 	case EHoudiniParameterType::Asset:
 	{
-		if (bUpdateTags) ((UHoudiniParameterAsset*)InOutParm)->SetShouldImportInfo(bImportInfo);
-		if (bUpdateValues) ((UHoudiniParameterAsset*)InOutParm)->UpdateValue(StringValues);
-		if (bUpdateDefaultValues) ((UHoudiniParameterAsset*)InOutParm)->UpdateDefaultValue(StringValues);
+		if (bUpdateValues) ((UHoudiniParameterAsset*)this)->UpdateValue(StringValues);
+		if (bUpdateDefaultValues) ((UHoudiniParameterAsset*)this)->UpdateDefaultValue(StringValues);
 	}
 	break;
 	case EHoudiniParameterType::AssetChoice:
 	{
-		if (bUpdateValues) ((UHoudiniParameterAssetChoice*)InOutParm)->UpdateValue(StringValues);
-		if (bUpdateDefaultValues) ((UHoudiniParameterAssetChoice*)InOutParm)->UpdateDefaultValue(StringValues);
-		((UHoudiniParameterAssetChoice*)InOutParm)->UpdateChoices(InParmInfo.choiceIndex, InParmInfo.choiceCount, ChoiceValues);
+		if (bUpdateValues) ((UHoudiniParameterAssetChoice*)this)->UpdateValue(StringValues);
+		if (bUpdateDefaultValues) ((UHoudiniParameterAssetChoice*)this)->UpdateDefaultValue(StringValues);
+		((UHoudiniParameterAssetChoice*)this)->UpdateChoices(InParmInfo.choiceIndex, InParmInfo.choiceCount, ChoiceValues);
 	}
 	break;
 	case EHoudiniParameterType::Input:
-		if (bUpdateValues || bUpdateDefaultValues) ((UHoudiniParameterInput*)InOutParm)->UpdateValue(StringValues);
+		if (bUpdateValues || bUpdateDefaultValues) ((UHoudiniParameterInput*)this)->UpdateValue(StringValues);
 		break;
 	case EHoudiniParameterType::Label:
-		if (bUpdateValues || bUpdateDefaultValues) ((UHoudiniParameterLabel*)InOutParm)->UpdateValue(StringValues);
+		if (bUpdateValues || bUpdateDefaultValues) ((UHoudiniParameterLabel*)this)->UpdateValue(StringValues);
 		break;
 
 	// Extras
 	case EHoudiniParameterType::MultiParm:
 	{
-		if (bUpdateValues) ((UHoudiniMultiParameter*)InOutParm)->UpdateInstanceCount(InParmInfo.instanceCount);
-		if (bUpdateDefaultValues && PrevParm != InOutParm)  // Default count of MultiParms has been update via UHoudiniMultiParameter::HapiSync
-			((UHoudiniMultiParameter*)InOutParm)->UpdateDefaultInstanceCount(InParmInfo.instanceCount);
+		if (bUpdateValues) ((UHoudiniMultiParameter*)this)->UpdateInstanceCount(InParmInfo.instanceCount);
+		if (bUpdateDefaultValues)
+			((UHoudiniMultiParameter*)this)->UpdateDefaultInstanceCount(InParmInfo.instanceCount);
 	}
 	break;
 	case EHoudiniParameterType::FloatRamp:
 	case EHoudiniParameterType::ColorRamp:
 	{
-		if (bUpdateValues) ((UHoudiniParameterRamp*)InOutParm)->UpdateValue(IntValues, FloatValues);
-		if (bUpdateDefaultValues) ((UHoudiniParameterRamp*)InOutParm)->UpdateDefaultValue(IntValues, FloatValues);
+		if (bUpdateValues) ((UHoudiniParameterRamp*)this)->UpdateValue(IntValues, FloatValues);
+		if (bUpdateDefaultValues) ((UHoudiniParameterRamp*)this)->UpdateDefaultValue(IntValues, FloatValues);
 	}
 	break;
 	}
-
-	// Try reuse the previous values of legacy parm if possible
-	if (!bIsAttribute && bBeforeCook && PrevParm && (PrevParm != InOutParm))
-		InOutParm->ReuseValuesFromLegacyParameter(PrevParm);
-
-	return true;
 }
 
 bool UHoudiniParameter::HapiGetUnit(const int32& NodeId, const int32& ParmId, FString& Unit)
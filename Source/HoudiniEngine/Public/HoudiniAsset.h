@@ -43,6 +43,8 @@ public:
 
 	bool NeedLoad();  // Check if asset has been loaded in current session
 
+	uint32 GetContentHash() const;  // Identify the hda by file path and timestamp, or by buffer if file NOT exists
+
 	FORCEINLINE void RegisterInstantiatedNode(const TWeakObjectPtr<const AHoudiniNode>& Node) { InstantiatedNodes.AddUnique(Node); }
 
 	FORCEINLINE void UnregisterInstantiatedNode(const TWeakObjectPtr<const AHoudiniNode>& Node) { InstantiatedNodes.Remove(Node); }
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "Misc/ScopeRWLock.h"
 
 #include "HAPI/HAPI_Common.h"
 
@@ -46,14 +47,30 @@ protected:
 	// -------- Current session exclusively --------
 	HAPI_Session Session = { HAPI_SESSION_MAX, -1 };
 
+	TArray<HAPI_Session> PooledSessions;  // Extra sessions for cooking nodes in parallel, SessionIdx = pooled index + 1, SessionIdx 0 is Session
+
+	mutable FRWLock SessionLock;  // Guard Session and PooledSessions, as cook tasks read them in other threads while game thread may reset them
+
 	bool bSessionSync = false;
 	
 	float SessionCheckDeltaTime = 0.0f;  // Check is session valid per second
 
-	TArray<TWeakObjectPtr<const UHoudiniAsset>> LoadedAssets;  // Should empty when session loss or restart session
+	TMap<TWeakObjectPtr<const UHoudiniAsset>, uint32> LoadedAssets;  // Value is the bit mask of SessionIdx, should empty when session loss or restart session
 
 	uint32 NumWorkingTasks = 0;  // For async cook/instantiate, disable all editing when async processing
 
+	TMap<TWeakObjectPtr<const AHoudiniNode>, uint32> NodeWorkingTasks;  // Tasks belong to nodes, will NOT block other independent nodes to cook
+
+	uint32 NumNodeWorkingTasks = 0;  // Sum of NodeWorkingTasks, tasks that NOT belong to any node (start session, etc.) are exclusive
+
+	double CookBatchStartTime = -1.0;  // < 0.0 means no node is cooking, for measure how much the cook and output stages overlapped
+
+	double CookBatchCookTime = 0.0;
+
+	double CookBatchOutputTime = 0.0;
+
+	int32 NumCookBatchNodes = 0;
+
 	float EngineMaxFPS = 0.0f;  // For slow down engine tick while cooking, the MaxFPS should be backup for recover
 
 	bool bEngineFPSLimited = false;
@@ -79,6 +96,12 @@ protected:
 
 	void CacheNameActorMap();  // Cache when cook triggered, so we can call GetActorByName
 
+	bool bPendingWarmUp = false;  // Marked when world changed, then WarmUp() in next tick, after all nodes in this level registered
+
+	void WarmUp();  // Start sessions and preload all hdas referenced by current nodes asynchronously, in background
+
+	bool HapiPreloadAssets(const TArray<TWeakObjectPtr<UHoudiniAsset>>& Assets);  // Load into all sessions
+
 
 	void RegisterIntrinsicBuilders();  // Will register input and output builders
 
@@ -94,15 +117,17 @@ protected:
 
 	void UnregisterActorInputDelegates();
 
-	bool HapiInitializeSession();
+	bool HapiInitializeSession(const HAPI_Session& InSession);
 
 	bool Tick(float DeltaTime);  // Will Start cook process
 
+	bool DispatchCook(AHoudiniNode* Node);  // Return false if session is invalid
+
 	void StartTick();
 
 	void StopTick();
 	
-	FORCEINLINE void ResetSession() { Session.type = HAPI_SESSION_MAX; Session.id = -1; }
+	FORCEINLINE void ResetSession() { FWriteScopeLock WriteLock(SessionLock); Session.type = HAPI_SESSION_MAX; Session.id = -1; PooledSessions.Empty(); }
 
 public:
 	DECLARE_MULTICAST_DELEGATE_OneParam(FOnHoudiniNodeRegisteredEvent, AHoudiniNode*)
@@ -161,7 +186,11 @@ public:
 
 	void DestroyActorByName(const FName& ActorName);
 
-	FORCEINLINE const HAPI_Session* GetSession() const { return &Session; }
+	const HAPI_Session* GetSession() const;  // Return a thread local copy of the session of FHoudiniSessionScope in current thread, will ensure when called outside a scope with multiple sessions
+
+	int32 AcquireSessionIndex() const;  // Return the SessionIdx that has the least nodes bound
+
+	static int32 GetCurrentSessionIndex();  // SessionIdx of FHoudiniSessionScope in current thread, should pass it to other threads
 
 	FORCEINLINE bool IsNullSession() const { return (Session.id == -1 || Session.type == HAPI_SESSION_MAX); }
 
@@ -179,6 +208,8 @@ public:
 
 	bool HapiOpenSceneInHoudini();
 
+	bool HapiSetServerEnvString(const char* VarName, const FString& Value) const;  // Will set to all sessions
+
 	void InvalidateSessionData();
 
 	bool AllowEdit() const;  // No Task is running, and HAPI has been initialized
@@ -189,17 +220,37 @@ public:
 	// Should only call in game thread
 	FORCEINLINE void FinishHoudiniTask() { if (NumWorkingTasks >= 1) --NumWorkingTasks; }
 
+	// Should only call in game thread, node tasks will NOT block other independent nodes to cook
+	void StartHoudiniTask(const AHoudiniNode* Node);
+
+	// Should only call in game thread, will recover engine frame rate when all nodes finished
+	void FinishHoudiniTask(const AHoudiniNode* Node);
+
+	FORCEINLINE bool IsNodeWorking(const TWeakObjectPtr<const AHoudiniNode>& Node) const { return NodeWorkingTasks.Contains(Node); }
+
+	FORCEINLINE int32 GetNumWorkingNodes() const { return NodeWorkingTasks.Num(); }
+
+	void ScheduleCooks();  // Dispatch the nodes that are ready to cook, should only call in game thread
+
+	void RecordCookStart();
+
+	void RecordCookFinish(const double& CookTime, const double& OutputTime);  // Will log the stage times when all nodes finished
+
 	void LimitEngineFrameRate();  // Useful when async execute houdini tasks, spare more compute resources for session tasks
 
 	void RecoverEngineFrameRate();
 
-	FORCEINLINE void RegisterLoadedAsset(const TWeakObjectPtr<const UHoudiniAsset>& InHoudiniAsset) { LoadedAssets.AddUnique(InHoudiniAsset); }
+	FORCEINLINE void RegisterLoadedAsset(const TWeakObjectPtr<const UHoudiniAsset>& InHoudiniAsset) { LoadedAssets.FindOrAdd(InHoudiniAsset) |= (1u << GetCurrentSessionIndex()); }
+
+	FORCEINLINE void UnregisterLoadedAsset(const TWeakObjectPtr<const UHoudiniAsset>& InHoudiniAsset) { LoadedAssets.Remove(InHoudiniAsset); }  // Unload from all sessions
+
+	FORCEINLINE bool IsAssetLoaded(const TWeakObjectPtr<const UHoudiniAsset>& InHoudiniAsset) const { return (LoadedAssets.FindRef(InHoudiniAsset) & (1u << GetCurrentSessionIndex())) != 0; }
 
-	FORCEINLINE bool IsAssetLoaded(const TWeakObjectPtr<const UHoudiniAsset>& InHoudiniAsset) const { return LoadedAssets.Contains(InHoudiniAsset); }
+	FORCEINLINE bool IsAssetLoadedInAnySession(const TWeakObjectPtr<const UHoudiniAsset>& InHoudiniAsset) const { return LoadedAssets.Contains(InHoudiniAsset); }
 
 	FORCEINLINE const TArray<TWeakObjectPtr<AHoudiniNode>>& GetCurrentNodes() { return CurrNodes; }
 
-	static const FString& GetProcessIdentifier();  // For houdini named-pipe session create and shared memory data transport
+	static const FString& GetProcessIdentifier();  // For houdini named-pipe session create and shared memory data transport, differs between sessions
 
 	static const FString& GetPluginDir();
 
@@ -209,3 +260,17 @@ public:
 
 	void InitializeHAPI();  // Will refresh LoadedHoudiniBinDir
 };
+
+// Redirect FHoudiniEngine::GetSession() to the session of SessionIdx in current thread, until this scope ends
+class HOUDINIENGINE_API FHoudiniSessionScope
+{
+public:
+	FHoudiniSessionScope(const int32& SessionIdx);
+
+	FHoudiniSessionScope(const AHoudiniNode* Node);  // Use the session that node bound to
+
+	~FHoudiniSessionScope();
+
+protected:
+	int32 PrevSessionIdx = 0;
+};
@@ -305,6 +305,7 @@ HOUDINIENGINE_API DECLARE_LOG_CATEGORY_EXTERN(LogHoudiniEngine, Log, All)
 #define HAPI_UNREAL_OUTPUT_INSTANCE_TYPE_CHAOS              6  // GeometryCollection
 #define HAPI_ATTRIB_UNREAL_INSTANCE_NUM_CUSTOM_FLOATS       "unreal_num_custom_floats"
 #define HAPI_ATTRIB_UNREAL_INSTANCE_CUSTOM_DATA_PREFIX      "unreal_per_instance_custom_data"
+#define HAPI_ATTRIB_UNREAL_INSTANCE_ID                      "unreal_instance_id"  // (Optional) int point attrib, stable id across cooks (e.g. i@unreal_instance_id = i@id), ISMC will only apply changed instances
 #define HAPI_UNREAL_ATTRIB_FORCE_INSTANCER                  "unreal_force_instancer"  // <Deprecated>, use s@unreal_instance_output_type = "ism" or i@unreal_instance_output_type = 1 instead
 #define HAPI_UNREAL_ATTRIB_HIERARCHICAL_INSTANCED_SM        "unreal_hierarchical_instancer"  // <Deprecated>, use s@unreal_instance_output_type = "hierarchical" or i@unreal_instance_output_type = 2 instead
 #define HAPI_UNREAL_ATTRIB_FOLIAGE_INSTANCER                "unreal_foliage"  // <Deprecated>, use s@unreal_instance_output_type = "foliage" or i@unreal_instance_output_type = 5 instead
@@ -349,6 +350,7 @@ HOUDINIENGINE_API DECLARE_LOG_CATEGORY_EXTERN(LogHoudiniEngine, Log, All)
 #define HAPI_UNREAL_TEXTURE_STORAGE_FLOAT16                 1
 #define HAPI_UNREAL_TEXTURE_STORAGE_UINT16                  2
 #define HAPI_UNREAL_TEXTURE_STORAGE_FLOAT                   3
+#define HAPI_ATTRIB_UNREAL_SVT_FRAME                        "unreal_svt_frame"  // (Optional) int prim attrib on VDBs, frame index of animated sparse volume texture
 
 // -------- Input --------
 #define HAPI_ATTRIB_UNREAL_ACTOR_OUTLINER_PATH              "unreal_actor_outliner_path"
@@ -397,6 +399,7 @@ HOUDINIENGINE_API DECLARE_LOG_CATEGORY_EXTERN(LogHoudiniEngine, Log, All)
 #define HAPI_MESSAGE_START_SESSION_SYNC                     "Open Houdini Session Sync..."
 #define HAPI_MESSAGE_START_SESSION                          "Start HARS...\n(Houdini Engine API Remote Server)"
 #define HAPI_MESSAGE_RESTART_SESSION                        "Restart HARS...\n(Houdini Engine API Remote Server)"
+#define HAPI_MESSAGE_WARM_UP                                "Warm up Houdini Engine...\n(Start HARS and load HDAs)"
 
 // -------- Platform --------
 #define HAPI_HOUDINI_BIN_DIR                                "bin"
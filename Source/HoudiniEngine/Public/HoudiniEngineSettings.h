@@ -36,6 +36,12 @@ public:
 	UPROPERTY(config, EditAnywhere, meta = (Units = "MB", EditCondition = "SessionType == EHoudiniSessionType::SharedMemory", ToolTip = "Only when Shared Memory Session Type. For reference, a 8k resolution landscape need at least 256 MB"))
 	uint16 SharedMemoryBufferSize = 512;
 
+	UPROPERTY(config, EditAnywhere, meta = (ClampMin = 1, ClampMax = 32, UIMax = 8, ToolTip = "Num of sessions(houdini processes) to cook nodes in parallel, each session may take a Houdini Engine license. Nodes linked by node inputs will always cook in the same session. With only 1 session, nodes cook one at a time whatever MaxConcurrentCooks is"))
+	int32 NumSessions = 1;
+
+	UPROPERTY(config, EditAnywhere, meta = (ToolTip = "Start sessions and load hdas in background when a level containing HoudiniNodes opened, so the first cook need NOT wait for them. Editing HoudiniNodes is blocked until warm up finished, and sessions will start and take licenses even if no node cooks"))
+	bool bWarmUpOnLevelOpened = false;
+
 	UPROPERTY(config, EditAnywhere, meta = (ToolTip = "Display detailed progress while cooking and instantiating, but will have a longer cook time"))
 	bool bVerbose = false;
 
@@ -48,6 +54,18 @@ public:
 	UPROPERTY(config, EditAnyWhere, DisplayName = "Max FPS While Cooking", meta = (EditCondition = "bLimitFPSWhileCooking", ToolTip = "Save computing resources for Houdini"))
 	float MaxFPSWhileCooking = 12.0f;
 
+	UPROPERTY(config, EditAnyWhere, meta = (ClampMin = 1, UIMin = 1, UIMax = 16, ToolTip = "Max num of nodes cook at the same time, a node will start cook only after all its upstream nodes finished. The actual limit is the num of started sessions if less, as nodes in the same session could NOT cook in parallel, so NumSessions must also be raised, otherwise nodes cook one at a time. Input uploads still run on game thread, only HAPI cooks run in parallel"))
+	int32 MaxConcurrentCooks = 4;
+
+	UPROPERTY(config, EditAnyWhere, meta = (ToolTip = "On the first cook after level loaded, skip cook and keep the saved outputs if hda, parameters and inputs are identical to the last cook. Rebuild, manual and force cook will always cook"))
+	bool bCookCache = true;
+
+	UPROPERTY(config, EditAnyWhere, meta = (ClampMin = 1, UIMin = 1, UIMax = 32, ToolTip = "Num of file nodes to load PDG work item outputs in parallel with committing them. More nodes use more memory in Houdini, but the PDG cook will less likely wait for the editor"))
+	int32 PDGFileNodePoolSize = 8;
+
+	UPROPERTY(config, EditAnyWhere, meta = (Units = "ms", ClampMin = 1.0, UIMin = 1.0, UIMax = 100.0, ToolTip = "Time per frame to commit PDG work item outputs, larger values finish sooner but make the editor less responsive"))
+	float PDGOutputCommitBudget = 10.0f;
+
 	UPROPERTY(config, EditAnyWhere, meta = (ToolTip = "(Global) Automatically trigger node cook after input changed"))
 	bool bCookOnInputChanged = true;
 
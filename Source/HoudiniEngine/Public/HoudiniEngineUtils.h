@@ -5,9 +5,14 @@
 #include <string>
 #include "CoreMinimal.h"
 
+#include "Async/ParallelFor.h"
+
 #include "HAPI/HAPI_Common.h"
 
 
+#define HOUDINI_TRANSPOSE_TILE_SIZE 64  // 64 * 64 float tile is 16KB, so both src and dst rows of a tile could stay in L1 cache
+#define HOUDINI_TRANSFORM_CONVERT_BATCH_SIZE 4096
+
 #define IS_ASSET_PATH_INVALID(ASSET_PATH) (!ASSET_PATH.Contains(TEXT("'/")) && !ASSET_PATH.StartsWith(TEXT("/")))
 #define PRINT_HOUDINI_FLOAT(VALUE) *FString::SanitizeFloat(FMath::RoundToInt64((VALUE) * 100.0) * 0.0001, 0)
 
@@ -167,14 +172,111 @@ public:
 	// -------- Misc ---------
 	static int32 BinarySearch(const TArray<int32>& SortedArray, const int32& Elem);  // Return the negative index pos if NOT found, and index if found
 
+	// Dst[X * DstStride + Y] = Convert(Src[Y * SrcStride + X]), X and Y is swaped between unreal landscape and houdini heightfield.
+	// Process by tiles, as a naive row loop will write with a stride of the whole row, and almost every store misses cache on large volumes
+	template<typename TDst, typename TSrc, typename TConvertFunc>
+	static void TransposeData(TDst* Dst, const int32& DstStride, const TSrc* Src, const int32& SrcStride,
+		const int32& SizeX, const int32& SizeY, const TConvertFunc& Convert)
+	{
+		const int32 NumTilesX = FMath::DivideAndRoundUp(SizeX, HOUDINI_TRANSPOSE_TILE_SIZE);
+		const int32 NumTilesY = FMath::DivideAndRoundUp(SizeY, HOUDINI_TRANSPOSE_TILE_SIZE);
+		ParallelFor(NumTilesX * NumTilesY, [&](int32 TileIdx)
+			{
+				const int32 XStart = (TileIdx % NumTilesX) * HOUDINI_TRANSPOSE_TILE_SIZE;
+				const int32 YStart = (TileIdx / NumTilesX) * HOUDINI_TRANSPOSE_TILE_SIZE;
+				const int32 XEnd = FMath::Min(XStart + HOUDINI_TRANSPOSE_TILE_SIZE, SizeX);
+				const int32 YEnd = FMath::Min(YStart + HOUDINI_TRANSPOSE_TILE_SIZE, SizeY);
+				for (int32 X = XStart; X < XEnd; ++X)
+				{
+					TDst* DstPtr = Dst + size_t(X) * DstStride;
+					const TSrc* SrcPtr = Src + X;
+					for (int32 Y = YStart; Y < YEnd; ++Y)
+						DstPtr[Y] = Convert(SrcPtr[size_t(Y) * SrcStride]);
+				}
+			});
+	}
+
 	static void ConvertLandscapeTransform(float OutHapiTransform[9],
 		const FTransform& LandscapeTransform, const FIntRect& LandscapeExtent);
 
 	static HAPI_TransformEuler ConvertTransform(const FTransform& Transform);
 
+	static void ConvertHapiTransforms(const HAPI_Transform* HapiTransforms, FTransform* OutTransforms, const int32& Num);  // Batched and parallel, swap Y/Z and scale to unreal
+
 	static EHoudiniVolumeConvertDataType ConvertTextureSourceFormat(const ETextureSourceFormat& TextureFormat);
 
 	static size_t GetElemSize(const EHoudiniVolumeConvertDataType& DataType);
 
 	static ULevel* GetCurrentLevel();
 };
+
+
+// Per-part attribute cache, collect all attributes a translator needs on a part, then fetch and serve them from cache.
+// HAPI has NO multi-attribute transport, so each existing attribute still costs one GetAttributeInfo and one Get*AttributeData.
+// Owners are resolved by AttribNames, so missing attributes never cost a round-trip, the same request only be fetched once,
+// and string handles of all string attributes will be converted in a single batch
+class HOUDINIENGINE_API FHoudiniAttributeFetchPlanner
+{
+public:
+	FHoudiniAttributeFetchPlanner(const int32& InNodeId, const HAPI_PartInfo& InPartInfo, const TArray<std::string>& InAttribNames) :
+		NodeId(InNodeId), PartInfo(InPartInfo), AttribNames(InAttribNames) {}
+
+	// DesiredTupleSize must >= 1, PreferOwner is used when the attribute exists on multiple owners
+	void RequestFloat(const char* AttribName, const int32& DesiredTupleSize, const HAPI_AttributeOwner& PreferOwner = HAPI_ATTROWNER_INVALID);
+
+	void RequestEnum(const char* AttribName, const HAPI_AttributeOwner& PreferOwner = HAPI_ATTROWNER_INVALID);  // For int attribute that represent bool or enum
+
+	void RequestString(const char* AttribName, const HAPI_AttributeOwner& PreferOwner = HAPI_ATTROWNER_INVALID);
+
+	bool HapiFetch();  // Could be called multiple times, only the requests after last fetch will be issued
+
+	// Return empty data and HAPI_ATTROWNER_INVALID if the attribute NOT found, or the storage mismatched
+	const TArray<float>& GetFloatData(const char* AttribName, const int32& DesiredTupleSize, HAPI_AttributeOwner& OutOwner) const;
+
+	const TArray<int8>& GetEnumData(const char* AttribName, HAPI_AttributeOwner& OutOwner) const;
+
+	const TArray<HAPI_StringHandle>& GetStringHandles(const char* AttribName, HAPI_AttributeOwner& OutOwner) const;
+
+	FORCEINLINE const FString& GetString(const HAPI_StringHandle& SH) const { return SHStringMap.FindChecked(SH); }  // SH must from GetStringHandles
+
+protected:
+	enum class EFetchType : uint8
+	{
+		Float = 0,
+		Enum,
+		String
+	};
+
+	struct FFetchEntry
+	{
+		std::string Name;
+
+		EFetchType Type = EFetchType::Float;
+
+		int32 TupleSize = 1;
+
+		HAPI_AttributeOwner Owner = HAPI_ATTROWNER_INVALID;
+
+		bool bFetched = false;
+
+		TArray<float> FloatData;
+
+		TArray<int8> EnumData;
+
+		TArray<HAPI_StringHandle> SHs;
+	};
+
+	const int32 NodeId;
+
+	const HAPI_PartInfo& PartInfo;
+
+	const TArray<std::string>& AttribNames;
+
+	TArray<FFetchEntry> Entries;
+
+	TMap<HAPI_StringHandle, FString> SHStringMap;
+
+	const FFetchEntry* FindEntry(const char* AttribName, const EFetchType& Type, const int32& TupleSize) const;
+
+	void Request(const char* AttribName, const EFetchType& Type, const int32& TupleSize, const HAPI_AttributeOwner& PreferOwner);
+};
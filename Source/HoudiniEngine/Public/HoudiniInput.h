@@ -312,6 +312,12 @@ protected:
 
 	FORCEINLINE const FHoudiniInputSettings& GetSettings() const { return GetInput()->GetSettings(); }
 
+	static uint32 GetTransformHash(const FTransform& Transform);
+
+	static uint32 GetAssetContentHash(const FSoftObjectPath& AssetPath);  // Identify by saved package file, return 0 if has unsaved modifications
+
+	static uint32 GetComponentsContentHash(const TArray<const UActorComponent*>& Components, const TArray<FTransform>& Transforms);  // Serialized properties, transforms and referenced assets
+
 public:
 	FORCEINLINE const bool& ShouldCheckChanged() const { return GetSettings().bCheckChanged; }
 
@@ -335,6 +341,8 @@ public:
 	virtual void Destroy() { Invalidate(); }  // Will destroy unreal data, and invalidate houdini session data. When input destroy, this method will call
 
 	virtual bool HasChanged() const { return bHasChanged; }
+
+	virtual uint32 GetContentHash() const;  // As a part of AHoudiniNode cook key, return 0 if content could NOT be identified, then node must cook
 };
 
 // Inherit from builder and register using FHoudiniEngine::RegisterInputBuilder
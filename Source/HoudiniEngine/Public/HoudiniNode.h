@@ -88,7 +88,12 @@ struct HOUDINIENGINE_API FHoudiniTopNode
 
 	bool HapiCook(AHoudiniNode* Node);
 
-	bool HapiUpdateOutputs(AHoudiniNode* Node, const FString& PDGOutputIdentifier, const std::string& FilePath, int32& InOutFileInputNodeId);
+	bool HapiIngestOutputFile(const FString& PDGOutputIdentifier, const std::string& FilePath,  // Load and classify on worker thread, by a pooled file node
+		class FHoudiniOutputClassifier& OutputClassifier, struct FHoudiniPDGOutputResult& OutResult) const;
+
+	bool HapiCommitOutputs(AHoudiniNode* Node, const FHoudiniPDGOutputResult& Result);  // Must be called on game thread
+
+	bool CommitOutputs(AHoudiniNode* Node, struct FHoudiniPDGOutputIngestor& Ingestor);  // Commit ingested results within a per-frame time budget, return false if session should be invalidated
 
 	bool HapiDirty() const;
 
@@ -118,6 +123,8 @@ protected:
 	// -------- Get by HAPI_CreateNode --------
 	int32 NodeId = -1;
 
+	int32 SessionIdx = 0;  // Which session this node instantiated in, see FHoudiniEngine::GetSession()
+
 	// -------- From HAPI_AssetInfo --------
 	UPROPERTY()
 	FString Label;
@@ -166,6 +173,15 @@ protected:
 
 	EHoudiniNodeRequestCookMethod RequestCookMethod = EHoudiniNodeRequestCookMethod::None;
 
+	UPROPERTY()
+	uint32 LastCookKey = 0;  // Key of the saved outputs, 0 means outputs could NOT be reused, will reset when any parameter, input or editable geometry changed
+
+	bool bReuseOutputsOnLoad = false;  // Only set in PostLoad, the first cook after loading may keep the saved outputs, rebuild and manual cook will clear it
+
+	double CookTime = 0.0;  // Stage times of current cook, for profiling the pipelined cook
+
+	double OutputTime = 0.0;
+
 	mutable FTransform LastTransform = FTransform::Identity;
 
 	UPROPERTY()
@@ -181,6 +197,17 @@ protected:
 	UPROPERTY()
 	TMap<FString, FHoudiniAttributeParameterSet> GroupParmSetMap;
 
+	// -------- Parameter sync, only values will be refreshed after cook if parm templates NOT changed --------
+	uint32 ParmTemplateHash = 0;  // Hash of HAPI_NodeInfo counts and HAPI_ParmInfos, 0 means we should refresh parm templates
+
+	TArray<int32> SyncedIntValues;  // Values retrieved by last HapiUpdateParameters(false)
+
+	TArray<float> SyncedFloatValues;
+
+	TArray<FString> SyncedValueStrings;  // { StringValues, ChoiceValues, ChoiceLabels }
+
+	bool bParmsUploadedSinceSync = true;  // If false and values NOT changed in houdini, then we need NOT to update parms at all
+
 	UPROPERTY()
 	TArray<TObjectPtr<UHoudiniInput>> Inputs;
 
@@ -199,9 +226,17 @@ protected:
 
 	bool NeedInstantiate();
 
+	uint32 ComputeCookKey() const;  // Hash of hda, op name, parameter values and input contents, return 0 if any input content could NOT be identified
+
+	bool CanReuseOutputs() const;  // Whether we could skip HapiCook and HapiUpdateOutputs, and just keep the saved outputs
+
 	bool HapiSyncAttributeMultiParameters(const bool& bUpdateDefaultCount) const;
 
 	bool HapiCookUpstream(bool& bOutHasUpstreamCooking) const;
+
+	int32 FindUpstreamSessionIndex() const;  // Return -1 if no upstream node instantiated
+
+	bool HapiBindSession();  // Should call before instantiate, will move this node to the session that upstream nodes in
 	
 	bool HapiUpdatePDG();
 
@@ -233,7 +268,10 @@ protected:
 
 	void CleanupSplitActors();
 
-	void FinishCook();
+	bool HapiPostCook(  // Translate outputs, finish cook and record the stage times
+		const TArray<FString>& GeoNames, const TArray<HAPI_GeoInfo>& GeoInfos, const TArray<TArray<HAPI_PartInfo>>& GeoPartInfos);
+
+	void FinishCook(const bool& bNotifyDownstream = true);
 
 
 	void InvalidateEditableGeometryFeedback();  // Will reset merge and DeltaInfo node ids, clear GroupEditableNodeIdHandleMap and close shm handles
@@ -255,6 +293,8 @@ public:
 
 	FORCEINLINE const int32& GetNodeId() const { return NodeId; }
 
+	FORCEINLINE const int32& GetSessionIndex() const { return SessionIdx; }
+
 	FORCEINLINE const FString& GetHelpText() const { return HelpText; }
 
 	FORCEINLINE const TArray<UHoudiniParameter*>& GetParameters() const { return Parms; }
@@ -269,6 +309,8 @@ public:
 
 	FORCEINLINE bool NeedCook() const { return RequestCookMethod != EHoudiniNodeRequestCookMethod::None; }
 
+	FORCEINLINE const uint32& GetLastCookKey() const { return LastCookKey; }
+
 	FORCEINLINE const bool& CookOnParameterChanged() const { return bCookOnParameterChanged; }
 
 	FORCEINLINE const bool& CookOnUpstreamChanged() const { return bCookOnUpstreamChanged; }
@@ -292,7 +334,7 @@ public:
 	// ------- IHoudiniPresetHandler --------
 	virtual bool GetGenericParameters(TMap<FName, FHoudiniGenericParameter>& OutParms) const override;
 
-	virtual void SetGenericParameters(const TSharedPtr<const TMap<FName, FHoudiniGenericParameter>>& InPreset) override { Preset = InPreset; RequestCook(); }  // We should actually load preset in other place, because we may need to instantiate node first
+	virtual void SetGenericParameters(const TSharedPtr<const TMap<FName, FHoudiniGenericParameter>>& InPreset) override { Preset = InPreset; LastCookKey = 0; RequestCook(); }  // We should actually load preset in other place, because we may need to instantiate node first
 
 	virtual FString GetPresetPathFilter() const override;  // NOT EndsWith(TEXT("/"))
 
@@ -307,7 +349,9 @@ public:
 	FORCEINLINE void ForceCook() { RequestCookMethod = EHoudiniNodeRequestCookMethod::Force; }
 
 	UFUNCTION(BlueprintCallable, Category = "HoudiniNode")
-	FORCEINLINE void RequestRebuild() { bRebuildBeforeCook = true; RequestCookMethod = EHoudiniNodeRequestCookMethod::Changed; }
+	FORCEINLINE void RequestRebuild() { bRebuildBeforeCook = true; bReuseOutputsOnLoad = false; RequestCookMethod = EHoudiniNodeRequestCookMethod::Changed; }
+
+	FORCEINLINE void RequestManualCook() { bReuseOutputsOnLoad = false; RequestCook(); }  // Cook requested by user, so should never keep the saved outputs
 
 	UFUNCTION(BlueprintCallable, Category = "HoudiniNode")
 	FORCEINLINE void RequestPDGCook(const int32 TopNodeIdx) { if (TopNodes.IsValidIndex(TopNodeIdx)) { TopNodes[TopNodeIdx].Task = FHoudiniTopNode::EPDGTaskType::PendingCook; ForceCook(); } }
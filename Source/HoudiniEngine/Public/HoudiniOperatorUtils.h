@@ -40,6 +40,24 @@ enum class EHoudiniInputAttributeCompression
 #define HOUDINI_SHM_GEO_INPUT_POLY     -1
 #define HOUDINI_SHM_GEO_INPUT_POLYLINE -2
 
+class HOUDINIENGINE_API FHoudiniSharedMemoryArena
+{
+public:
+	// Round Size32 up to a size class, so that a segment could be reused when the geometry size changes slightly
+	static size_t GetSizeClass(const size_t& Size32);
+
+	// Keep the segment mapped until its handle closed, so re-upload to the same segment need NOT create and map it again
+	static float* FindOrCreate(const FString& SHMPath, const size_t& Capacity32, size_t& InOutHandle);
+
+	static void Unmap(const float* SHM);  // Will skip the persistent views of the arena
+
+	static void Release(const size_t& Handle);  // Called when close the shared memory handle
+
+	// Record the layout of the data written to the segment, return true if the previous write has the same LayoutKey,
+	// which means the segment still holds the previous data, so writer could only overwrite the dirty ranges
+	static bool UpdateLayoutKey(const size_t& Handle, const uint32& LayoutKey);
+};
+
 class HOUDINIENGINE_API FHoudiniSharedMemoryGeometryInput  // sharedmemory_geometryinput
 {
 protected:
@@ -51,6 +69,8 @@ protected:
 
 	size_t Size32 = 0;
 
+	bool bZeroFillGeometry = true;
+
 	struct FHoudiniSHMAttribInfo
 	{
 		std::string Name;
@@ -58,23 +78,30 @@ protected:
 		EHoudiniInputAttributeStorage Type = EHoudiniInputAttributeStorage::Group;
 		int32 TupleSize = 0;
 		EHoudiniInputAttributeCompression Compression = EHoudiniInputAttributeCompression::None;
+		size_t Offset32 = 0;
+		size_t Size32 = 0;
+		bool bZeroFill = true;
 	};
 
 	TArray<FHoudiniSHMAttribInfo> InputAttribInfos;
 
 public:
-	FHoudiniSharedMemoryGeometryInput(const int32& InNumPoints, const int32& InNumPrims, const int32& InNumVertices);
+	// If bZeroFill is false, means the writer will overwrite all data of this region, so GetSharedMemory need NOT zero it
+	FHoudiniSharedMemoryGeometryInput(const int32& InNumPoints, const int32& InNumPrims, const int32& InNumVertices, const bool& bInZeroFillGeometry = true);
 
 	// follow the methods below to upload geometry to houdini
 	static bool HapiCreateNode(const int32& ParentNodeId, const FString& NodeLabel, int32& OutNodeId);
 
-	void AppendGroup(const char* GroupName, const EHoudiniAttributeOwner& Class, const size_t& InSize32, const bool& bUniqueValue = false);
+	void AppendGroup(const char* GroupName, const EHoudiniAttributeOwner& Class, const size_t& InSize32, const bool& bUniqueValue = false,
+		const bool& bZeroFill = true);
 
 	void AppendAttribute(const char* AttribName,
 		const EHoudiniAttributeOwner& Class, const EHoudiniInputAttributeStorage& Storage, const int32& TupleSize, const size_t& InSize32,
-		const EHoudiniInputAttributeCompression& Compression = EHoudiniInputAttributeCompression::None);
+		const EHoudiniInputAttributeCompression& Compression = EHoudiniInputAttributeCompression::None, const bool& bZeroFill = true);
+
+	float* GetSharedMemory(const FString& SHMIdentifier, size_t& InOutHandle);  // Only zero the regions that marked as bZeroFill
 
-	float* GetSharedMemory(const FString& SHMIdentifier, size_t& InOutHandle);
+	uint32 GetLayoutHash() const;  // Hash of element counts and attribute infos, should be combined with the writer's own key for FHoudiniSharedMemoryArena::UpdateLayoutKey
 
 	bool HapiUpload(const int32& SHMGeoInputNodeId, const float* SHMToUnmap) const;
 };
@@ -218,6 +245,13 @@ struct HOUDINIENGINE_API FHoudiniSopAttribCreate
 	static bool HapiSetDeltaInfo(const int32& AttribCreateNodeId, const FString& DeltaInfo);
 };
 
+struct HOUDINIENGINE_API FHoudiniSopObjectMerge
+{
+	static bool HapiCreateNode(const int32& ParentNodeId, const FString& NodeLabel, int32& OutNodeId);
+
+	static bool HapiSetObjectPath(const int32& ObjectMergeNodeId, const FString& ObjectPath);
+};
+
 struct HOUDINIENGINE_API FHoudiniSopFile
 {
 	static bool HapiCreateNode(const int32& ParentNodeId, const FString& NodeLabel, int32& OutNodeId);
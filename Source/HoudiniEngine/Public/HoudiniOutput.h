@@ -44,11 +44,53 @@ public:
 	virtual void DestroyStandaloneActors() const {}
 };
 
+enum class EHoudiniPartGeometryFilter : uint8  // Only check on mesh parts
+{
+	Any = 0,
+	Faces,  // faceCount >= 1 && vertexCount >= 3
+	Points  // faceCount == 0 && pointCount >= 1
+};
+
+// Declare which parts a builder claims up front, so that parts could be classified without HAPI calls
+struct HOUDINIENGINE_API FHoudiniOutputClaimRule
+{
+	uint32 PartTypeMask = MAX_uint32;  // Bits of (1 << HAPI_PartType)
+
+	EHoudiniPartGeometryFilter GeometryFilter = EHoudiniPartGeometryFilter::Any;
+
+	TArray<TPair<std::string, EHoudiniAttributeOwner>> RequiredAttribs;  // EHoudiniAttributeOwner::Invalid means on any owner
+
+	TArray<TPair<std::string, EHoudiniAttributeOwner>> ExcludedAttribs;  // EHoudiniAttributeOwner::Invalid means on any owner
+
+	bool bFinal = true;  // If false, HapiIsPartValid will still be called when part matches this rule, to check attribute storages or values
+
+	bool bShouldHoldByOutput = true;  // Only used when bFinal
+
+	bool MatchPartInfo(const HAPI_PartInfo& PartInfo) const;
+
+	FORCEINLINE bool NeedAttribNames() const { return !RequiredAttribs.IsEmpty() || !ExcludedAttribs.IsEmpty(); }
+
+	bool MatchAttribNames(const TArray<std::string>& AttribNames, const int* AttribCounts) const;  // AttribNames should get by FHoudiniEngineUtils::HapiGetAttributeNames
+};
+
 // Inherit from builder and register using FHoudiniEngine::RegisterOutputBuilder
 // The register order of houdini engine itself: Landscape < Instancer < Asset < Spline/Curve < Mesh < SkeletalMesh(KineFX) < MaterialInstance < Texture(Image and VDB) < DataTable
 class HOUDINIENGINE_API IHoudiniOutputBuilder
 {
 public:
+	virtual bool GetClaimRule(FHoudiniOutputClaimRule& OutRule) const { return false; }  // Optional, return true if this builder has a claim rule, parts NOT match it will skip HapiIsPartValid
+
+	virtual bool GetClaimRules(TArray<FHoudiniOutputClaimRule>& OutRules) const  // Optional, override when a builder claims several kinds of parts, parts NOT match any of them will skip HapiIsPartValid
+	{
+		FHoudiniOutputClaimRule ClaimRule;
+		if (!GetClaimRule(ClaimRule))
+			return false;
+
+		OutRules.Add(ClaimRule);
+		return true;
+	}
+
+	// May be called on worker thread (PDG output ingestion), so should only make HAPI calls, NOT access UObjects or any other game thread state
 	virtual bool HapiIsPartValid(const int32& NodeId, const HAPI_PartInfo& PartInfo, bool& bOutIsValid, bool& bOutShouldHoldByOutput) = 0;
 
 	virtual TSubclassOf<UHoudiniOutput> GetClass() const { return nullptr; }  // Will be called when bOutShouldHoldByOutput == true
@@ -61,6 +103,55 @@ public:
 	virtual ~IHoudiniOutputBuilder() {}
 };
 
+// Classify parts to output builders, by walking builders backwards until one claims the part.
+// Classifications decided only by claim rules will be cached by part signature, so that the same kind of parts need NOT walk again
+class HOUDINIENGINE_API FHoudiniOutputClassifier
+{
+protected:
+	struct FPartSignature
+	{
+		FPartSignature(const HAPI_PartInfo& PartInfo);
+
+		int32 Type;
+
+		EHoudiniPartGeometryFilter Geometry;
+
+		bool bIsInstanced;
+
+		FORCEINLINE bool operator==(const FPartSignature& Other) const { return (Type == Other.Type) && (Geometry == Other.Geometry) && (bIsInstanced == Other.bIsInstanced); }
+
+		FORCEINLINE friend uint32 GetTypeHash(const FPartSignature& Signature) { return HashCombine(GetTypeHash(Signature.Type), GetTypeHash(uint8(Signature.Geometry) | (Signature.bIsInstanced ? 0x80 : 0x00))); }
+	};
+
+	struct FClassification
+	{
+		int32 BuilderIdx = INDEX_NONE;
+
+		bool bShouldHoldByOutput = false;
+	};
+
+	struct FClassificationCache
+	{
+		bool bNeedAttribNames = false;  // Whether claim rules need attribute names to classify this kind of parts
+
+		FClassification Classification;  // Used when !bNeedAttribNames
+
+		TMap<uint32, FClassification> AttribNamesClassificationMap;  // <AttribNamesHash, Classification>, used when bNeedAttribNames
+	};
+
+	const TArray<TSharedPtr<IHoudiniOutputBuilder>>& OutputBuilders;
+
+	TArray<TArray<FHoudiniOutputClaimRule>> ClaimRules;  // Empty means builder has no claim rule
+
+	TMap<FPartSignature, FClassificationCache> ClassificationCacheMap;
+
+public:
+	FHoudiniOutputClassifier(const TArray<TSharedPtr<IHoudiniOutputBuilder>>& InOutputBuilders);
+
+	bool HapiClassify(const int32& NodeId, const HAPI_PartInfo& PartInfo,  // OutBuilder will be nullptr if no builder claims this part
+		TSharedPtr<IHoudiniOutputBuilder>& OutBuilder, bool& bOutShouldHoldByOutput);
+};
+
 
 
 // Basic struct for all SplittableOutput, all outputs held by UHoudiniOutput are splittable
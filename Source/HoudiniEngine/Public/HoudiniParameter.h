@@ -125,6 +125,11 @@ public:
 		TConstArrayView<FString> ChoiceValues, TConstArrayView<FString> ChoiceLabels,
 		UHoudiniParameter*& InOutParm, const bool& bBeforeCook, const bool& bIsAttribute);
 
+	void UpdateValuesAndChoices(const HAPI_ParmInfo& InParmInfo,
+		const TArray<int32>& IntValues, const TArray<float>& FloatValues, TConstArrayView<FString> StringValues,
+		TConstArrayView<FString> ChoiceValues, TConstArrayView<FString> ChoiceLabels,
+		const bool& bUpdateValues, const bool& bUpdateDefaultValues);  // Parm info MUST have been updated, will NOT call HAPI
+
 	static bool HapiGetUnit(const int32& NodeId, const int32& ParmId, FString& Unit);
 
 	static EHoudiniParameterType GetParameterTypeFromInfo(const int32& NodeId, const HAPI_ParmInfo& InParmInfo);
@@ -46,33 +46,65 @@ void FHoudiniCurvesComponentVisualizer::DrawVisualization(const UActorComponent*
 	const bool& bDistanceCulling = Settings->bDistanceCulling;
 	const float& CullDistance = Settings->CullDistance;
 
+	// Cull by the bounds of curves and chunks, so that points and segments out of view will NOT be visited
+	CurvesComponent->RefreshDirtyCurveBounds();
+	const double CullDistanceSquared = double(CullDistance) * double(CullDistance);
+	auto IsBoundsVisibleLambda = [&](const FBox& Bounds)
+		{
+			const FBox WorldBounds = Bounds.TransformBy(ComponentTransform);
+			if (bDistanceCulling && (WorldBounds.ComputeSquaredDistanceToPoint(View->CullingOrigin) > CullDistanceSquared))
+				return false;
+
+			return View->ViewFrustum.IntersectBox(WorldBounds.GetCenter(), WorldBounds.GetExtent());
+		};
+
 	// -------- Points --------
 	const TArray<FHoudiniCurvePoint>& Points = CurvesComponent->GetPoints();
+	const TArray<FHoudiniCurve>& Curves = CurvesComponent->GetCurves();
 	TArray<bool> bPointsShouldDisplay;  // Cache results for curve edge shown
 	if (bShowPoint)
 	{
 		if (bDistanceCulling)
 			bPointsShouldDisplay.SetNumZeroed(Points.Num());
-		for (int32 PointIdx = 0; PointIdx < Points.Num(); ++PointIdx)
+		TBitArray<> bPointsVisited(false, Points.Num());  // Points may be shared by curves, should only draw once
+		for (const FHoudiniCurve& Curve : Curves)
 		{
-			const FHoudiniCurvePoint& Point = Points[PointIdx];
-			if (Point.Color.A < 0.5f)
+			if (!Curve.Bounds.IsValid || !IsBoundsVisibleLambda(Curve.Bounds))
 				continue;
 
-			const FVector Position = ComponentTransform.TransformPosition(Point.Transform.GetLocation());
-			if (bDistanceCulling)
+			for (int32 ChunkIdx = 0; ChunkIdx < Curve.PointChunkBounds.Num(); ++ChunkIdx)
 			{
-				if (FVector::Distance(Position, View->CullingOrigin) > CullDistance)
+				if (!IsBoundsVisibleLambda(Curve.PointChunkBounds[ChunkIdx]))
 					continue;
 
-				bPointsShouldDisplay[PointIdx] = true;
-			}
+				const int32 EndIdx = FMath::Min((ChunkIdx + 1) * HOUDINI_CURVE_BOUNDS_CHUNK_SIZE, Curve.PointIndices.Num());
+				for (int32 VtxIdx = ChunkIdx * HOUDINI_CURVE_BOUNDS_CHUNK_SIZE; VtxIdx < EndIdx; ++VtxIdx)
+				{
+					const int32& PointIdx = Curve.PointIndices[VtxIdx];
+					if (bPointsVisited[PointIdx])
+						continue;
+					bPointsVisited[PointIdx] = true;
+
+					const FHoudiniCurvePoint& Point = Points[PointIdx];
+					if (Point.Color.A < 0.5f)
+						continue;
 
-			PDI->SetHitProxy(new HHoudiniPointVisProxy(CurvesComponent, HPP_UI, PointIdx));
-			PDI->DrawPoint(Position,
-				CurvesComponent->IsPointSelected(PointIdx) ? FLinearColor(Point.Color) * FLinearColor(1.0f, 0.2f, 0.1f) : Point.Color,
-				PointSize, SDPG_Foreground);
-			PDI->SetHitProxy(nullptr);
+					const FVector Position = ComponentTransform.TransformPosition(Point.Transform.GetLocation());
+					if (bDistanceCulling)
+					{
+						if (FVector::Distance(Position, View->CullingOrigin) > CullDistance)
+							continue;
+
+						bPointsShouldDisplay[PointIdx] = true;
+					}
+
+					PDI->SetHitProxy(new HHoudiniPointVisProxy(CurvesComponent, HPP_UI, PointIdx));
+					PDI->DrawPoint(Position,
+						CurvesComponent->IsPointSelected(PointIdx) ? FLinearColor(Point.Color) * FLinearColor(1.0f, 0.2f, 0.1f) : Point.Color,
+						PointSize, SDPG_Foreground);
+					PDI->SetHitProxy(nullptr);
+				}
+			}
 		}
 	}
 
@@ -80,56 +112,61 @@ void FHoudiniCurvesComponentVisualizer::DrawVisualization(const UActorComponent*
 	if (!bShowCurve)
 		return;
 
-	const TArray<FHoudiniCurve>& Curves = CurvesComponent->GetCurves();
 	for (int32 CurveIdx = 0; CurveIdx < Curves.Num(); ++CurveIdx)
 	{
 		const FHoudiniCurve& Curve = Curves[CurveIdx];
 		if (Curve.NoNeedDisplay())
 			continue;
 		
+		if (Curve.DisplayPoints.IsEmpty())  // We should generate display points
+			const_cast<UHoudiniCurvesComponent*>(CurvesComponent)->RefreshCurveDisplayPoints(CurveIdx);
+
+		if (!IsBoundsVisibleLambda(Curve.Bounds))
+			continue;
+
 		if (bDistanceCulling)
 		{
 			bool bCull = true;
 			for (const int32& PointIdx : Curve.PointIndices)
 			{
-				if (bPointsShouldDisplay.IsValidIndex(PointIdx))
+				if (bPointsShouldDisplay.IsValidIndex(PointIdx) && bPointsShouldDisplay[PointIdx])
 				{
-					if (bPointsShouldDisplay[PointIdx])
-					{
-						bCull = false;
-						break;
-					}
+					bCull = false;
+					break;
 				}
-				else
+				
+				const FVector Position = ComponentTransform.TransformPosition(Points[PointIdx].Transform.GetLocation());
+				if (FVector::Distance(Position, View->CullingOrigin) < CullDistance)
 				{
-					const FVector Position = ComponentTransform.TransformPosition(Points[PointIdx].Transform.GetLocation());
-					if (FVector::Distance(Position, View->CullingOrigin) < CullDistance)
-					{
-						bCull = false;
-						break;
-					}
+					bCull = false;
+					break;
 				}
 			}
 			if (bCull)
 				continue;
 		}
 
-		if (Curve.DisplayPoints.IsEmpty())  // We should generate display points
-			const_cast<UHoudiniCurvesComponent*>(CurvesComponent)->RefreshCurveDisplayPoints(CurveIdx);
-
 		const bool bCurveSelected = CurvesComponent->IsPrimSelected(CurveIdx);
 		const TArray<FVector>& DisplayPoints = Curve.DisplayPoints;
 		const FLinearColor CurveColor = bCurveSelected ? FLinearColor(Curve.Color) * FLinearColor(1.0f, 0.2f, 0.1f) : Curve.Color;
 
 		PDI->SetHitProxy(new HHoudiniPrimVisProxy(CurvesComponent, HPP_UI, CurveIdx));
 
-		FVector PrevPos = ComponentTransform.TransformPosition(DisplayPoints[0]);
-		for (int32 DisplayIdx = 1; DisplayIdx < DisplayPoints.Num(); ++DisplayIdx)
+		FVector PrevPos;
+		for (int32 ChunkIdx = 0; ChunkIdx < Curve.DisplayChunkBounds.Num(); ++ChunkIdx)
 		{
-			const FVector CurrPos = ComponentTransform.TransformPosition(DisplayPoints[DisplayIdx]);
-			PDI->DrawLine(PrevPos, CurrPos, CurveColor,
-				SDPG_Foreground, EdgeThickness, 0.0f, true);
-			PrevPos = CurrPos;
+			if (!IsBoundsVisibleLambda(Curve.DisplayChunkBounds[ChunkIdx]))
+				continue;
+
+			const int32 EndIdx = FMath::Min((ChunkIdx + 1) * HOUDINI_CURVE_BOUNDS_CHUNK_SIZE, DisplayPoints.Num() - 1);
+			PrevPos = ComponentTransform.TransformPosition(DisplayPoints[ChunkIdx * HOUDINI_CURVE_BOUNDS_CHUNK_SIZE]);
+			for (int32 DisplayIdx = ChunkIdx * HOUDINI_CURVE_BOUNDS_CHUNK_SIZE + 1; DisplayIdx <= EndIdx; ++DisplayIdx)
+			{
+				const FVector CurrPos = ComponentTransform.TransformPosition(DisplayPoints[DisplayIdx]);
+				PDI->DrawLine(PrevPos, CurrPos, CurveColor,
+					SDPG_Foreground, EdgeThickness, 0.0f, true);
+				PrevPos = CurrPos;
+			}
 		}
 		
 		// Draw curve handles, only for subdiv and bezier
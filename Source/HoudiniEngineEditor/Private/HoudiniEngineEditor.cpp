@@ -194,10 +194,8 @@ void FHoudiniEngineEditor::RegisterEditorDelegates()
 
 			if (!FHoudiniEngine::Get().IsNullSession())  // Update level path folder env var
 			{
-				HAPI_Result Result = FHoudiniApi::SetServerEnvString(FHoudiniEngine::Get().GetSession(),
-					HAPI_ENV_CLIENT_SCENE_PATH, TCHAR_TO_UTF8(*GEditor->GetEditorWorldContext().World()->GetCurrentLevel()->GetPathName()));
-				if (HAPI_SESSION_INVALID_RESULT(Result))
-					FHoudiniEngine::Get().InvalidateSessionData();
+				HOUDINI_FAIL_INVALIDATE(FHoudiniEngine::Get().HapiSetServerEnvString(HAPI_ENV_CLIENT_SCENE_PATH,
+					GEditor->GetEditorWorldContext().World()->GetCurrentLevel()->GetPathName()));
 			}
 		});
 
@@ -437,7 +435,7 @@ void FHoudiniEngineEditor::RegisterCommands()
 										for (const TWeakObjectPtr<AHoudiniNode>& SelectedNode : SelectedNodes)
 										{
 											if (SelectedNode.IsValid())
-												SelectedNode->RequestCook();
+												SelectedNode->RequestManualCook();
 										}
 									}),
 								FCanExecuteAction::CreateLambda([] { return true; })
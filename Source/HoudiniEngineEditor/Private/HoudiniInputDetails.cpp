@@ -502,7 +502,10 @@ void FHoudiniInputDetails::CreateWidgetContent(IDetailCategoryBuilder& CategoryB
 						if (UHoudiniInputHolder* NewHolder = InputBuilders[BuilderIdx]->CreateOrUpdate(Input.Get(), AssetData.GetAsset(), CurrHolder))
 						{
 							if (NewHolder != CurrHolder && IsValid(CurrHolder))
+							{
+								const FHoudiniSessionScope SessionScope(Input->GetNode());
 								HOUDINI_FAIL_INVALIDATE(CurrHolder->HapiDestroy());
+							}
 							Input->Holders[HolderIdx] = NewHolder;
 						}
 					}
@@ -186,7 +186,10 @@ void FHoudiniPDGDetails::CreateWidgets(IDetailCategoryBuilder& CategoryBuilder,
 					.OnClicked_Lambda([Node, TopNodeIdx]()
 						{
 							if (Node.IsValid() && Node->GetTopNodes().IsValidIndex(TopNodeIdx))
+							{
+								const FHoudiniSessionScope SessionScope(Node.Get());
 								HOUDINI_FAIL_INVALIDATE(Node->GetTopNodes()[TopNodeIdx].HapiDirty());
+							}
 
 							return FReply::Handled();
 						})
@@ -229,6 +232,7 @@ void FHoudiniPDGDetails::CreateWidgets(IDetailCategoryBuilder& CategoryBuilder,
 						if (!Node->GetTopNodes().IsValidIndex(TopNodeIdx))
 							return FReply::Handled();
 
+						const FHoudiniSessionScope SessionScope(Node.Get());
 						HOUDINI_FAIL_INVALIDATE(Node->GetTopNodes()[TopNodeIdx].HapiDirtyAll());
 						return FReply::Handled();
 					})